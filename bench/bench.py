@@ -0,0 +1,295 @@
+#!/usr/bin/env python3
+################################################################################
+# Cycle accurate benchmarks of every effect, run under simavr.                 #
+#                                                                              #
+# Builds lamp.ino once per effect with the probes in bench/probe.h, runs it    #
+# under simavr and reads back the cycle at which each phase of each frame      #
+# started. Results are compared against bench/baseline.txt and the run fails   #
+# if any effect got slower or hungrier, or has no baseline to compare against. #
+#                                                                              #
+# Author:   Kip (https://github.com/kip93/).                                   #
+# Source:   https://github.com/kip93/lamp/                                     #
+# License:  BSD 3-Clause                                                       #
+################################################################################
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+BASELINE = os.path.join(ROOT, 'bench', 'baseline.txt')
+
+# Every effect in lamp.ino, by the name used here and its class (for LAMP_EFFECT).
+EFFECTS = {
+    'fire': 'Fire',
+    'matrix': 'Matrix',
+    'rainbow': 'Rainbow',
+    'stars': 'Stars',
+    'starry-rainbow': 'StarryRainbow',
+    'remote': 'Remote',
+    'lava': 'Lava',
+}
+
+# Phase ids, as in Effect::Phase. 0 is time spent outside of update().
+PHASES = {0: 'loop', 1: 'effect', 2: 'fill', 3: 'show', 4: 'wait'}
+
+# Columns of the baseline file.
+COLUMNS = ['compute', 'jitter', 'sram']
+
+
+def sources(args, work):
+    """The tree to build from: this one, or a git revision of it (see --rev)."""
+    if args.rev is None:
+        return ROOT
+
+    tree = os.path.join(work, 'tree')
+    os.makedirs(tree)
+    archive = subprocess.run(['git', '-C', ROOT, 'archive', args.rev, 'lamp.ino', 'effects', 'bench'],
+                             check=True, capture_output=True).stdout
+    subprocess.run(['tar', '-x', '-C', tree], input=archive, check=True)
+    return tree
+
+
+def build(effect, args, work):
+    """Build the firmware for an effect. Returns the path to the ELF file."""
+    root = sources(args, work)
+
+    # Sketches must live in a folder named like their main file.
+    sketch = os.path.join(work, 'lamp')
+    os.makedirs(sketch)
+    shutil.copy(os.path.join(root, 'lamp.ino'), sketch)
+    shutil.copytree(os.path.join(root, 'effects'), os.path.join(sketch, 'effects'))
+    os.makedirs(os.path.join(sketch, 'bench'))
+    shutil.copy(os.path.join(root, 'bench', 'probe.h'), os.path.join(sketch, 'bench'))
+
+    flags = ['-DLAMP_BENCH', '-DLAMP_EFFECT=' + EFFECTS[effect],
+             '-DLAMP_BENCH_FRAMES=%d' % args.frames, '-I' + args.simavr_include]
+    flags += ['-D' + define for define in args.define]
+    output = os.path.join(work, 'build')
+    subprocess.run([args.arduino_cli, 'compile', '--fqbn', args.fqbn,
+                    '--build-property', 'compiler.cpp.extra_flags=' + ' '.join(flags),
+                    '--output-dir', output, sketch],
+                   check=True, stdout=subprocess.DEVNULL)
+
+    return os.path.join(output, 'lamp.ino.elf')
+
+
+def static_ram(elf, args):
+    """Size of the .data and .bss sections."""
+    out = subprocess.run([args.avr_size, '-A', elf], check=True, capture_output=True, text=True)
+    total = 0
+    for line in out.stdout.splitlines():
+        fields = line.split()
+        if len(fields) >= 2 and fields[0] in ('.data', '.bss'):
+            total += int(fields[1])
+    return total
+
+
+def simulate(elf, args, work):
+    """Run the firmware until it stops. Returns the path to the VCD trace."""
+    subprocess.run([args.simavr, '-m', args.mcu, '-f', str(args.f_cpu), elf],
+                   cwd=work, check=True, timeout=args.timeout,
+                   stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return os.path.join(work, 'bench.vcd')
+
+
+def parse_vcd(path, f_cpu):
+    """Read a VCD trace. Returns {signal: [(cycle, value), ...]}."""
+    scale = {'s': 1, 'ms': 1e-3, 'us': 1e-6, 'ns': 1e-9, 'ps': 1e-12}
+    timescale = 1e-9
+    names, changes = {}, {}
+    now, header = 0, True
+
+    with open(path) as vcd:
+        tokens = vcd.read().split()
+
+    i = 0
+    while i < len(tokens):
+        token = tokens[i]
+        if token == '$timescale':
+            unit = tokens[i + 1]
+            number = ''.join(c for c in unit if c.isdigit())
+            suffix = unit[len(number):] or tokens[i + 2]
+            timescale = int(number or 1) * scale[suffix]
+        elif token == '$var':
+            # $var wire <size> <id> <name> $end
+            names[tokens[i + 3]] = tokens[i + 4]
+            changes[tokens[i + 4]] = []
+        elif token == '$enddefinitions':
+            header = False
+        elif header:
+            pass
+        elif token.startswith('#'):
+            now = round(int(token[1:]) * timescale * f_cpu)
+        elif token[0] in 'bB':
+            value, ident = token[1:], tokens[i + 1]
+            if ident in names and all(c in '01' for c in value):
+                changes[names[ident]].append((now, int(value, 2)))
+            i += 1
+        i += 1
+
+    return changes
+
+
+def decode_data(changes):
+    """Rebuild the 16-bit values sent through GPIOR2 by bench_send()."""
+    nibbles = [value & 0x0F for _, value in changes if value & 0x80]
+    return [(nibbles[k] << 12) | (nibbles[k + 1] << 8) | (nibbles[k + 2] << 4) | nibbles[k + 3]
+            for k in range(0, len(nibbles) - 3, 4)]
+
+
+def analyse(changes):
+    """Cycles spent in every phase of every frame."""
+    ends = [cycle for cycle, _ in changes['frame']]
+    phases = changes['phase']
+
+    frames = []
+    for start, end in zip(ends, ends[1:]):  # The first frame is left out as warm up.
+        frame = dict.fromkeys(PHASES.values(), 0)
+        current, since = 0, start
+        for cycle, value in phases:
+            if cycle <= start:
+                current = value
+                continue
+            if cycle >= end:
+                break
+            frame[PHASES.get(current, 'loop')] += cycle - since
+            current, since = value, cycle
+        frame[PHASES.get(current, 'loop')] += end - since
+        frame['period'] = end - start
+        frame['compute'] = frame['period'] - frame['wait']
+        frames.append(frame)
+
+    return frames
+
+
+def bench(effect, args):
+    work = tempfile.mkdtemp(prefix='lamp-bench-')
+    try:
+        elf = build(effect, args, work)
+        changes = parse_vcd(simulate(elf, args, work), args.f_cpu)
+        frames = analyse(changes)
+        if not frames:
+            raise RuntimeError('no frames were recorded for ' + effect)
+
+        data = decode_data(changes['data'])
+        heap, stack = (data + [0, 0])[:2]
+        periods = [frame['period'] for frame in frames]
+        result = {key: sum(frame[key] for frame in frames) // len(frames)
+                  for key in list(PHASES.values()) + ['period', 'compute']}
+        result['compute_max'] = max(frame['compute'] for frame in frames)
+        # LEDs worked out per millisecond spent on the effect and filling the buffer.
+        result['throughput'] = (args.leds * args.f_cpu // 1000 //
+                                max(result['effect'] + result['fill'], 1))
+        result['jitter'] = max(periods) - min(periods)
+        result['static'] = static_ram(elf, args)
+        result['heap'] = heap
+        result['stack'] = stack
+        result['sram'] = result['static'] + heap + stack
+        # Arena bytes each effect takes, in the order of lamp.ino's Runtime.
+        result['footprints'] = data[3:3 + data[2]] if len(data) > 2 else []
+        return result
+    finally:
+        if args.keep:
+            print('kept', work, file=sys.stderr)
+        else:
+            shutil.rmtree(work, ignore_errors=True)
+
+
+def read_baseline():
+    baseline = {}
+    if os.path.exists(BASELINE):
+        with open(BASELINE) as f:
+            for line in f:
+                fields = line.split('#', 1)[0].split()
+                if fields:
+                    baseline[fields[0]] = dict(zip(COLUMNS, map(int, fields[1:])))
+    return baseline
+
+
+def write_baseline(results):
+    with open(BASELINE, 'w') as f:
+        f.write('# Benchmark baseline, as written by `bench/bench.py --update`.\n')
+        f.write('# Cycles are averages per frame, excluding the time waiting for the next one.\n')
+        f.write('# %-8s %10s %10s %10s\n' % tuple(['effect'] + COLUMNS))
+        for effect in sorted(results):
+            f.write('%-10s %10d %10d %10d\n' % tuple([effect] + [results[effect][c] for c in COLUMNS]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Cycle accurate benchmarks of every effect, run under simavr.')
+    parser.add_argument('effects', nargs='*', default=list(EFFECTS),
+                        help='effects to run (default: all): ' + ', '.join(EFFECTS))
+    parser.add_argument('--frames', type=int, default=32, help='frames to simulate per effect')
+    parser.add_argument('--tolerance', type=float, default=0.02,
+                        help='allowed relative growth in cycles before failing')
+    parser.add_argument('--update', action='store_true', help='write the results as the new baseline')
+    parser.add_argument('--rev', help='benchmark a git revision instead of the working tree, e.g. to '
+                                      'compare a change against its parent')
+    parser.add_argument('--keep', action='store_true', help='keep the build directories')
+    parser.add_argument('--fqbn', default='arduino:avr:nano', help='board to build for')
+    parser.add_argument('--mcu', default='atmega328p', help='MCU to simulate')
+    parser.add_argument('--f-cpu', type=int, default=16000000, help='clock frequency')
+    parser.add_argument('--timeout', type=int, default=600, help='seconds per simulation')
+    parser.add_argument('--define', action='append', default=[], metavar='NAME=VALUE',
+                        help='extra macro for the build, e.g. EFFECT_REFRESH=0 (repeatable)')
+    parser.add_argument('--leds', type=int, default=16 * 14, help='LEDs in the matrix')
+    parser.add_argument('--arduino-cli', default=os.environ.get('ARDUINO_CLI', 'arduino-cli'))
+    parser.add_argument('--avr-size', default=os.environ.get('AVR_SIZE', 'avr-size'))
+    parser.add_argument('--simavr', default=os.environ.get('SIMAVR', 'simavr'))
+    parser.add_argument('--simavr-include', default=os.environ.get('SIMAVR_INCLUDE', '/usr/include'),
+                        help='directory containing simavr/avr/avr_mcu_section.h')
+    args = parser.parse_args()
+    if args.update and args.rev is not None:
+        parser.error('--update records the working tree, and can\'t be combined with --rev')
+    for effect in args.effects:
+        if effect not in EFFECTS:
+            parser.error('unknown effect %s' % effect)
+
+    baseline = read_baseline()
+    results = {}
+    failed = False
+
+    print('%-8s %9s %9s %9s %9s %9s %9s %8s %6s %6s %6s %6s %6s' %
+          ('effect', 'fill', 'effect', 'show', 'compute', 'max', 'period', 'jitter',
+           'px/ms', 'static', 'heap', 'stack', 'sram'))
+    for effect in args.effects:
+        result = results[effect] = bench(effect, args)
+        print('%-8s %9d %9d %9d %9d %9d %9d %8d %6d %6d %6d %6d %6d' %
+              (effect, result['fill'], result['effect'], result['show'], result['compute'],
+               result['compute_max'], result['period'], result['jitter'], result['throughput'],
+               result['static'], result['heap'], result['stack'], result['sram']))
+
+        if effect not in baseline:
+            if not args.update:
+                print('  MISSING: no baseline for %s, record one with --update' % effect)
+                failed = True
+            continue
+
+        for column in COLUMNS:
+            old, new = baseline[effect][column], result[column]
+            limit = old if column == 'sram' else old * (1 + args.tolerance)
+            if new > limit:
+                print('  REGRESSION: %s %s went from %d to %d (%+.1f%%)' %
+                      (effect, column, old, new, 100.0 * (new - old) / max(old, 1)))
+                failed = True
+
+    # Every build holds every effect, so any of them tells what each one takes.
+    footprints = next((r['footprints'] for r in results.values() if r['footprints']), [])
+    if footprints:
+        print('\narena bytes per effect: ' +
+              ', '.join('%s %d' % (name, size) for name, size in zip(EFFECTS, footprints)))
+
+    if args.update:
+        baseline.update({effect: {c: results[effect][c] for c in COLUMNS} for effect in results})
+        write_baseline(baseline)
+        return 0
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,108 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Benchmark instrumentation, for running the lamp under simavr.                *
+*                                                                              *
+* Every phase change is written to GPIOR0 and every finished frame bumps       *
+* GPIOR1. Both registers are traced by simavr into a VCD file with the exact   *
+* cycle of each write, so the measurement itself costs a single instruction    *
+* and keeps working while FastLED has interrupts disabled. Memory usage, as    *
+* measured by effects/memory.h, and the SRAM each effect takes are reported at *
+* the end through GPIOR2, one nibble at a time.                                *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef BENCH_PROBE_H_
+#define BENCH_PROBE_H_
+
+#include <avr/io.h>                // GPIOR registers.
+#include <avr/interrupt.h>         // cli().
+#include <avr/sleep.h>             // sleep_cpu().
+#include <simavr/avr/avr_mcu_section.h>  // Simulator configuration.
+
+#include "../effects/memory.h"  // Stack and heap usage.
+
+
+#ifndef LAMP_BENCH_FRAMES
+/**
+ * The amount of frames to run before stopping the simulation.
+ */
+#define LAMP_BENCH_FRAMES 32
+#endif
+
+#ifndef LAMP_BENCH_VCD
+/**
+ * The file simavr writes the trace to.
+ */
+#define LAMP_BENCH_VCD "bench.vcd"
+#endif
+
+// Report every phase change.
+#define EFFECT_PROBE(phase) (GPIOR0 = (phase))
+
+// Tell simavr what to simulate and what to trace.
+AVR_MCU(F_CPU, "atmega328p");
+AVR_MCU_VCD_FILE(LAMP_BENCH_VCD, 1000);
+
+const struct avr_mmcu_vcd_trace_t bench_traces[] _MMCU_ = {
+    { AVR_MMCU_TAG_VCD_TRACE, sizeof(struct avr_mmcu_vcd_trace_t) - 2, 0, (void *) &GPIOR0, "phase" },
+    { AVR_MMCU_TAG_VCD_TRACE, sizeof(struct avr_mmcu_vcd_trace_t) - 2, 0, (void *) &GPIOR1, "frame" },
+    { AVR_MMCU_TAG_VCD_TRACE, sizeof(struct avr_mmcu_vcd_trace_t) - 2, 0, (void *) &GPIOR2, "data" },
+};
+
+/**
+ * Amount of frames shown so far.
+ */
+static uint16_t bench_frames = 0;
+
+/**
+ * Send a 16-bit value through GPIOR2, most significant nibble first. Each nibble
+ * is tagged with 0x80 and followed by a 0, so every write shows up on the trace.
+ */
+static void bench_send(uint16_t value) {
+    for(int8_t shift = 12; shift >= 0; shift -= 4) {
+        GPIOR2 = 0x80 | ((value >> shift) & 0x0F);
+        GPIOR2 = 0x00;
+    }
+}
+
+/**
+ * To be called once the effect has been set up. The free RAM must have been painted
+ * already (see Memory::paint()), as the sketch does first thing at start up.
+ */
+static void bench_begin() {
+    GPIOR0 = 0;
+    GPIOR1 = 0;
+    GPIOR2 = 0;
+}
+
+/**
+ * To be called after every frame. After enough frames this reports the memory
+ * usage, then the amount of effects and the SRAM each one takes in the arena, and
+ * stops the simulation.
+ *
+ * @param lamp The runtime the effects run in (see Runtime).
+ */
+template<class R> static void bench_frame(const R &lamp) {
+    GPIOR0 = 0;
+    GPIOR1 = (uint8_t) ++bench_frames;
+
+    if(bench_frames < LAMP_BENCH_FRAMES) {
+        return;
+    }
+
+    bench_send(Memory::heap());
+    bench_send(Memory::stack_peak());
+    bench_send(lamp.count);
+    for(uint8_t n = 0; n < lamp.count; ++n) {
+        bench_send(lamp.footprint(n));
+    }
+
+    // Sleeping with interrupts disabled makes simavr exit.
+    cli();
+    sleep_enable();
+    sleep_cpu();
+}
+
+#endif  // BENCH_PROBE_H_
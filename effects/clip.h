@@ -0,0 +1,152 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Playback of pre-rendered animations stored in flash.                         *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef CLIP_H_
+#define CLIP_H_
+
+#include <avr/pgmspace.h>  // Allow access to PROGMEM.
+
+#include "effect.h"  // Abstract effect structure.
+
+
+/**
+ * Effect that plays a clip kept in flash, over and over. Clips are made by
+ * host/clip.py out of frames rendered on a computer, e.g. by running other effects
+ * through host/render.
+ *
+ * Colours come from a palette of up to 256 colours, and each frame only says how it
+ * differs from the previous one, as a list of operations. Every operation starts
+ * with a byte holding its kind in the top 2 bits and, but for OP_END, an amount of
+ * LEDs minus one in the rest:
+ *
+ *     OP_SKIP     LEDs that keep their colour.
+ *     OP_RUN      LEDs of a single colour, followed by its palette index.
+ *     OP_LITERAL  LEDs of different colours, followed by a palette index for each.
+ *     OP_END      The rest of the LEDs keep their colour.
+ *
+ * LEDs are in storage order (see Effect::index()). The first frame changes every LED,
+ * so looping needs no special case.
+ *
+ * Frames are decoded straight into the frame buffer, which holds the previous one,
+ * so nothing is staged in SRAM and LEDs that don't change cost nothing. That only
+ * works while the effect owns the buffer, so the clip starts over whenever it
+ * doesn't (e.g. during transitions, which fade to black instead).
+ *
+ * @param C The clip. A type with `static const` members `fps`, `leds` (the size of
+ *          the matrix it was made for) and `frames`, and `palette` (R, G and B for
+ *          each colour) and `data` (the frames, one after the other) arrays in
+ *          PROGMEM.
+ */
+template<class C> class Clip : public Effect {
+
+    static_assert(C::leds == num_leds, "The clip was made for a matrix of another size");
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The frame rate the effect is meant to run at.
+         */
+        static const uint8_t fps = C::fps;
+
+        /**
+         * The kinds of operations a frame is made of.
+         */
+        enum Op : uint8_t {
+            OP_SKIP    = 0,
+            OP_RUN     = 1,
+            OP_LITERAL = 2,
+            OP_END     = 3,
+        };
+
+        /**
+         * Update the contents of the LED matrix.
+         */
+        void update() {
+            if(!owns()) {
+                fill(CRGB::Black);
+                present(fps);
+                frame = 0;
+                next = C::data;
+                return;
+            }
+
+            decode();
+            present(fps);
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * The next frame to be shown, and where it starts in flash.
+         */
+        uint16_t frame = 0;
+        const uint8_t *next = C::data;
+
+        /**
+         * Decode the next frame into the frame buffer, over the previous one.
+         */
+        void decode() {
+            EFFECT_PROBE(PHASE_FILL);
+            if(frame == C::frames) {
+                frame = 0;
+                next = C::data;
+            }
+
+            CRGB *leds = pixels();
+            Index n = 0, low = num_leds, high = 0;
+            while(n < num_leds) {
+                const uint8_t op = pgm_read_byte(next++);
+                const uint8_t count = (op & 0x3F) + 1;
+
+                switch(op >> 6) {
+                    case OP_SKIP:
+                        n += count;
+                        continue;
+
+                    case OP_RUN: {
+                        const CRGB colour = get_colour(pgm_read_byte(next++));
+                        low = n < low ? n : low;
+                        for(uint8_t k = 0; k < count; ++k) {
+                            leds[n++] = colour;
+                        }
+                        break;
+                    }
+
+                    case OP_LITERAL:
+                        low = n < low ? n : low;
+                        for(uint8_t k = 0; k < count; ++k) {
+                            leds[n++] = get_colour(pgm_read_byte(next++));
+                        }
+                        break;
+
+                    case OP_END:
+                        n = num_leds;
+                        continue;
+                }
+                high = n;
+            }
+
+            if(high > low) {
+                changed(low, high - low);
+            }
+            ++frame;
+            EFFECT_PROBE(PHASE_EFFECT);
+        }
+
+        /**
+         * Get a colour from the clip's palette.
+         *
+         * @param index The position of the colour in the palette.
+         */
+        static CRGB get_colour(uint8_t index) {
+            const uint8_t *entry = C::palette + 3 * (uint16_t) index;
+            return CRGB(pgm_read_byte(entry), pgm_read_byte(entry + 1), pgm_read_byte(entry + 2));
+        }
+};
+
+#endif  // CLIP_H_
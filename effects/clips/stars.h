@@ -0,0 +1,433 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Clip made by host/clip.py. Do not edit.                                      *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef CLIPS_STARS_H_
+#define CLIPS_STARS_H_
+
+#include <avr/pgmspace.h>  // Allow access to PROGMEM.
+
+
+struct StarsClip {
+    static const uint8_t fps = 60;
+    static const uint16_t leds = 224;
+    static const uint16_t frames = 120;
+    static const uint8_t palette[708];
+    static const uint8_t data[5733];
+};
+
+const uint8_t StarsClip::palette[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05,
+    0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x0A,
+    0x0A, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F,
+    0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x14, 0x14, 0x14, 0x15,
+    0x15, 0x15, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x1A,
+    0x1A, 0x1B, 0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F,
+    0x20, 0x20, 0x20, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25,
+    0x25, 0x25, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x28, 0x28, 0x28, 0x29, 0x29, 0x29, 0x2A, 0x2A,
+    0x2A, 0x2B, 0x2B, 0x2B, 0x2C, 0x2C, 0x2C, 0x2D, 0x2D, 0x2D, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F,
+    0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x32, 0x32, 0x32, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35,
+    0x35, 0x35, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x39, 0x39, 0x39, 0x3A, 0x3A,
+    0x3A, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3C, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x3F,
+    0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x44, 0x44, 0x44, 0x45,
+    0x45, 0x45, 0x46, 0x46, 0x46, 0x47, 0x47, 0x47, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x4A, 0x4A,
+    0x4A, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F,
+    0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x55,
+    0x55, 0x55, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x5A, 0x5A,
+    0x5A, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F,
+    0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x65,
+    0x65, 0x65, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x6A, 0x6A,
+    0x6A, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F,
+    0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x75,
+    0x75, 0x75, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x7A, 0x7A,
+    0x7A, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F,
+    0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85,
+    0x85, 0x85, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x8A, 0x8A,
+    0x8A, 0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F,
+    0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x95,
+    0x95, 0x95, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x9A, 0x9A,
+    0x9A, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F,
+    0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA5,
+    0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA,
+    0xAA, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF,
+    0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB3, 0xB3, 0xB3, 0xB4, 0xB4, 0xB4, 0xB5,
+    0xB5, 0xB5, 0xB6, 0xB6, 0xB6, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xBA, 0xBA,
+    0xBA, 0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF,
+    0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC3, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC5,
+    0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC8, 0xC8, 0xC8, 0xC9, 0xC9, 0xC9, 0xCA, 0xCA,
+    0xCA, 0xCB, 0xCB, 0xCB, 0xCC, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCE, 0xCE, 0xCE, 0xCF, 0xCF, 0xCF,
+    0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD5,
+    0xD5, 0xD5, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xDA, 0xDA,
+    0xDA, 0xDB, 0xDB, 0xDB, 0xDD, 0xDD, 0xDD, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xE3,
+    0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE9, 0xE9, 0xE9, 0xEA, 0xEA, 0xEA, 0xEB,
+    0xEB, 0xEB, 0xEC, 0xEC, 0xEC, 0xED, 0xED, 0xED, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xF1, 0xF1,
+    0xF1, 0xF2, 0xF2, 0xF2,
+};
+
+const uint8_t StarsClip::data[] PROGMEM = {
+    0x43, 0x00, 0x80, 0x39, 0x48, 0x00, 0x80, 0x9D, 0x45, 0x00, 0x80, 0x7F, 0x4B, 0x00, 0x80, 0x72,
+    0x66, 0x00, 0x80, 0x8B, 0x52, 0x00, 0x80, 0x70, 0x4F, 0x00, 0x83, 0x77, 0x00, 0x00, 0x6B, 0x4A,
+    0x00, 0x80, 0x84, 0x4A, 0x00, 0x80, 0x95, 0x45, 0x00, 0x80, 0x69, 0x43, 0x00, 0x80, 0xC4, 0x69,
+    0x00, 0x80, 0x66, 0x5A, 0x00, 0x82, 0x54, 0x00, 0x00, 0x03, 0x80, 0x35, 0x08, 0x80, 0x9A, 0x05,
+    0x80, 0x81, 0x0B, 0x80, 0x6F, 0x26, 0x80, 0x86, 0x12, 0x80, 0x6D, 0x0F, 0x80, 0x74, 0x01, 0x80,
+    0x6C, 0x0A, 0x80, 0x83, 0x0A, 0x80, 0x93, 0x0A, 0x80, 0xC5, 0x3F, 0x05, 0x80, 0x52, 0xC0, 0x03,
+    0x80, 0x31, 0x08, 0x80, 0x96, 0x05, 0x80, 0x84, 0x0B, 0x80, 0x6D, 0x26, 0x80, 0x80, 0x12, 0x80,
+    0x6A, 0x0F, 0x80, 0x70, 0x19, 0x80, 0x92, 0x05, 0x80, 0x68, 0x03, 0x80, 0xC6, 0x3F, 0x05, 0x80,
+    0x50, 0xC0, 0x03, 0x80, 0x2D, 0x08, 0x80, 0x93, 0x05, 0x80, 0x86, 0x0B, 0x80, 0x6A, 0x26, 0x80,
+    0x7B, 0x12, 0x80, 0x67, 0x0F, 0x80, 0x6C, 0x01, 0x80, 0x6D, 0x16, 0x80, 0x90, 0x0A, 0x80, 0xC7,
+    0x29, 0x80, 0x65, 0x1A, 0x80, 0x4D, 0xC0, 0x03, 0x80, 0x2A, 0x08, 0x80, 0x90, 0x05, 0x80, 0x89,
+    0x0B, 0x80, 0x67, 0x26, 0x80, 0x76, 0x12, 0x80, 0x65, 0x1E, 0x80, 0x82, 0x0A, 0x80, 0x8F, 0x05,
+    0x80, 0x67, 0x03, 0x80, 0xC1, 0x3F, 0x05, 0x80, 0x4B, 0xC0, 0x03, 0x80, 0x26, 0x08, 0x80, 0x8D,
+    0x05, 0x80, 0x8B, 0x0B, 0x80, 0x65, 0x26, 0x80, 0x71, 0x23, 0x80, 0x6E, 0x01, 0x80, 0x6E, 0x16,
+    0x80, 0x8D, 0x0A, 0x80, 0xBC, 0x3F, 0x05, 0x80, 0x48, 0xC0, 0x03, 0x80, 0x23, 0x08, 0x80, 0x89,
+    0x05, 0x80, 0x8D, 0x0B, 0x80, 0x62, 0x3F, 0x0B, 0x80, 0x70, 0x01, 0x80, 0x6F, 0x0A, 0x80, 0x81,
+    0x0A, 0x80, 0x8C, 0x05, 0x80, 0x66, 0x03, 0x80, 0xB7, 0x29, 0x80, 0x64, 0x1A, 0x80, 0x46, 0xC0,
+    0x03, 0x80, 0x20, 0x08, 0x80, 0x87, 0x05, 0x80, 0x90, 0x0B, 0x80, 0x5F, 0x3F, 0x0B, 0x80, 0x72,
+    0x0D, 0x80, 0x80, 0x0A, 0x80, 0x8A, 0x05, 0x80, 0x65, 0x03, 0x80, 0xB3, 0x03, 0x80, 0xE2, 0x3F,
+    0x00, 0x80, 0x44, 0xC0, 0x03, 0x80, 0x1E, 0x08, 0x80, 0x83, 0x05, 0x80, 0x92, 0x0B, 0x80, 0x5D,
+    0x26, 0x80, 0x72, 0x23, 0x80, 0x73, 0x01, 0x80, 0x70, 0x16, 0x80, 0x89, 0x05, 0x80, 0x64, 0x03,
+    0x80, 0xAE, 0x03, 0x80, 0xDE, 0x3F, 0x00, 0x80, 0x41, 0xC0, 0x03, 0x80, 0x1D, 0x08, 0x80, 0x80,
+    0x05, 0x80, 0x94, 0x0B, 0x80, 0x5A, 0x3F, 0x0B, 0x80, 0x75, 0x0D, 0x80, 0x7F, 0x0A, 0x80, 0x87,
+    0x05, 0x80, 0x63, 0x03, 0x80, 0xA9, 0x03, 0x80, 0xDC, 0x24, 0x80, 0x63, 0x1A, 0x80, 0x3F, 0xC0,
+    0x03, 0x80, 0x1B, 0x08, 0x80, 0x7D, 0x05, 0x80, 0x96, 0x0B, 0x80, 0x58, 0x3F, 0x0B, 0x80, 0x77,
+    0x19, 0x80, 0x86, 0x05, 0x80, 0x60, 0x03, 0x80, 0xA4, 0x03, 0x80, 0xD7, 0x3F, 0x00, 0x80, 0x3D,
+    0xC0, 0x03, 0x80, 0x19, 0x08, 0x80, 0x7A, 0x05, 0x80, 0x98, 0x0B, 0x80, 0x55, 0x26, 0x80, 0x71,
+    0x12, 0x80, 0x64, 0x0F, 0x80, 0x79, 0x01, 0x80, 0x71, 0x0A, 0x80, 0x7C, 0x0A, 0x80, 0x85, 0x05,
+    0x80, 0x5B, 0x03, 0x80, 0xA0, 0x03, 0x80, 0xD2, 0x3F, 0x00, 0x80, 0x3B, 0xC0, 0x03, 0x80, 0x17,
+    0x08, 0x80, 0x7C, 0x05, 0x80, 0x9A, 0x0B, 0x80, 0x53, 0x3F, 0x0B, 0x80, 0x7B, 0x0D, 0x80, 0x79,
+    0x0A, 0x80, 0x83, 0x05, 0x80, 0x57, 0x03, 0x80, 0x9B, 0x03, 0x80, 0xCD, 0x24, 0x80, 0x62, 0x1A,
+    0x80, 0x38, 0xC0, 0x03, 0x80, 0x15, 0x08, 0x80, 0x7D, 0x05, 0x80, 0x99, 0x0B, 0x80, 0x50, 0x3F,
+    0x0B, 0x80, 0x7C, 0x01, 0x80, 0x72, 0x0A, 0x80, 0x76, 0x0A, 0x80, 0x82, 0x05, 0x80, 0x52, 0x03,
+    0x80, 0x97, 0x03, 0x80, 0xC8, 0x3F, 0x00, 0x80, 0x36, 0xC0, 0x03, 0x80, 0x13, 0x08, 0x80, 0x7E,
+    0x05, 0x80, 0x95, 0x0B, 0x80, 0x4E, 0x26, 0x80, 0x70, 0x12, 0x80, 0x63, 0x0F, 0x80, 0x7E, 0x0D,
+    0x80, 0x72, 0x0A, 0x80, 0x80, 0x05, 0x80, 0x4E, 0x03, 0x80, 0x92, 0x03, 0x80, 0xC3, 0x24, 0x80,
+    0x61, 0x1A, 0x80, 0x34, 0xC0, 0x03, 0x80, 0x11, 0x08, 0x80, 0x7F, 0x05, 0x80, 0x91, 0x0B, 0x80,
+    0x4C, 0x3F, 0x0B, 0x80, 0x7F, 0x01, 0x80, 0x6F, 0x0A, 0x80, 0x6F, 0x0A, 0x80, 0x7F, 0x05, 0x80,
+    0x4A, 0x03, 0x80, 0x8E, 0x03, 0x80, 0xBE, 0x3F, 0x00, 0x80, 0x32, 0xC0, 0x03, 0x80, 0x0E, 0x08,
+    0x80, 0x81, 0x05, 0x80, 0x8D, 0x0B, 0x80, 0x49, 0x26, 0x80, 0x6F, 0x12, 0x80, 0x62, 0x0F, 0x80,
+    0x81, 0x01, 0x80, 0x6D, 0x0A, 0x80, 0x6C, 0x0A, 0x80, 0x7D, 0x05, 0x80, 0x46, 0x03, 0x80, 0x89,
+    0x03, 0x80, 0xB9, 0x3F, 0x00, 0x80, 0x30, 0xC0, 0x03, 0x80, 0x0C, 0x08, 0x80, 0x82, 0x05, 0x80,
+    0x8A, 0x0B, 0x80, 0x47, 0x26, 0x80, 0x6E, 0x23, 0x80, 0x7F, 0x01, 0x80, 0x6B, 0x0A, 0x80, 0x69,
+    0x0A, 0x80, 0x7C, 0x05, 0x80, 0x42, 0x03, 0x80, 0x85, 0x03, 0x80, 0xB4, 0x24, 0x80, 0x60, 0x1A,
+    0x80, 0x2E, 0xC0, 0x03, 0x80, 0x09, 0x08, 0x80, 0x84, 0x05, 0x80, 0x86, 0x0B, 0x80, 0x45, 0x26,
+    0x80, 0x6D, 0x12, 0x80, 0x61, 0x0F, 0x80, 0x7C, 0x01, 0x80, 0x68, 0x0A, 0x80, 0x66, 0x0A, 0x80,
+    0x7B, 0x05, 0x80, 0x3E, 0x03, 0x80, 0x81, 0x03, 0x80, 0xAF, 0x3F, 0x00, 0x80, 0x2C, 0xC0, 0x03,
+    0x80, 0x06, 0x08, 0x80, 0x85, 0x05, 0x80, 0x82, 0x0B, 0x80, 0x42, 0x26, 0x80, 0x6C, 0x23, 0x80,
+    0x78, 0x01, 0x80, 0x66, 0x0A, 0x80, 0x64, 0x0A, 0x80, 0x79, 0x05, 0x80, 0x3A, 0x03, 0x80, 0x7D,
+    0x03, 0x80, 0xB1, 0x24, 0x80, 0x5F, 0x0D, 0x80, 0x92, 0x0B, 0x80, 0x2A, 0xC0, 0x03, 0x80, 0x04,
+    0x08, 0x80, 0x86, 0x05, 0x80, 0x7E, 0x0B, 0x80, 0x40, 0x26, 0x80, 0x68, 0x12, 0x80, 0x60, 0x0F,
+    0x80, 0x75, 0x01, 0x80, 0x64, 0x0A, 0x80, 0x60, 0x0A, 0x80, 0x78, 0x05, 0x80, 0x36, 0x03, 0x80,
+    0x7E, 0x03, 0x80, 0xB5, 0x33, 0x80, 0x8F, 0x0B, 0x80, 0x28, 0xC0, 0x03, 0x49, 0x00, 0x80, 0x87,
+    0x05, 0x80, 0x7A, 0x0B, 0x80, 0x3E, 0x26, 0x80, 0x64, 0x12, 0x80, 0x5F, 0x0F, 0x80, 0x71, 0x01,
+    0x80, 0x62, 0x0A, 0x80, 0x5E, 0x0A, 0x80, 0x76, 0x05, 0x80, 0x33, 0x03, 0x80, 0x7F, 0x03, 0x80,
+    0xB8, 0x24, 0x80, 0x5E, 0x0D, 0x80, 0x8C, 0x0B, 0x80, 0x25, 0xC0, 0x0D, 0x80, 0x89, 0x05, 0x80,
+    0x77, 0x0B, 0x80, 0x3D, 0x26, 0x80, 0x5F, 0x12, 0x80, 0x5E, 0x0F, 0x80, 0x6E, 0x01, 0x80, 0x60,
+    0x0A, 0x80, 0x5B, 0x0A, 0x80, 0x75, 0x05, 0x80, 0x2F, 0x03, 0x80, 0x80, 0x03, 0x80, 0xBB, 0x33,
+    0x80, 0x89, 0x0B, 0x80, 0x24, 0xC0, 0x0D, 0x80, 0x8A, 0x05, 0x80, 0x73, 0x0B, 0x80, 0x3C, 0x26,
+    0x80, 0x5A, 0x23, 0x80, 0x6B, 0x01, 0x80, 0x5D, 0x0A, 0x80, 0x58, 0x0A, 0x80, 0x74, 0x05, 0x80,
+    0x2C, 0x03, 0x80, 0x81, 0x03, 0x80, 0xBE, 0x24, 0x80, 0x5D, 0x0D, 0x80, 0x87, 0x0B, 0x80, 0x22,
+    0xC0, 0x0D, 0x80, 0x8B, 0x05, 0x80, 0x6F, 0x0B, 0x80, 0x3B, 0x26, 0x80, 0x56, 0x12, 0x80, 0x5D,
+    0x0F, 0x80, 0x67, 0x01, 0x80, 0x5B, 0x0A, 0x80, 0x55, 0x11, 0x80, 0x29, 0x03, 0x80, 0x82, 0x03,
+    0x80, 0xC2, 0x33, 0x80, 0x84, 0x0B, 0x80, 0x20, 0xC0, 0x0D, 0x80, 0x8C, 0x05, 0x80, 0x6C, 0x0B,
+    0x80, 0x3A, 0x26, 0x80, 0x52, 0x12, 0x80, 0x5C, 0x0F, 0x80, 0x64, 0x01, 0x80, 0x59, 0x0A, 0x80,
+    0x53, 0x11, 0x80, 0x28, 0x03, 0x80, 0x83, 0x03, 0x80, 0xC4, 0x33, 0x80, 0x82, 0x0B, 0x80, 0x1E,
+    0xC0, 0x0D, 0x80, 0x8D, 0x12, 0x80, 0x39, 0x26, 0x80, 0x4D, 0x12, 0x80, 0x58, 0x0F, 0x80, 0x61,
+    0x01, 0x80, 0x57, 0x01, 0x80, 0x9D, 0x07, 0x80, 0x50, 0x11, 0x80, 0x26, 0x03, 0x80, 0x84, 0x03,
+    0x80, 0xC8, 0x24, 0x80, 0x5C, 0x0D, 0x80, 0x7F, 0x0B, 0x80, 0x1C, 0xC0, 0x0D, 0x80, 0x8E, 0x05,
+    0x80, 0x6E, 0x0B, 0x80, 0x38, 0x26, 0x80, 0x49, 0x12, 0x80, 0x55, 0x0F, 0x80, 0x5E, 0x01, 0x80,
+    0x55, 0x01, 0x80, 0x9E, 0x07, 0x80, 0x4E, 0x11, 0x80, 0x25, 0x03, 0x80, 0x8A, 0x03, 0x80, 0xCB,
+    0x33, 0x80, 0x7D, 0x0B, 0x80, 0x1A, 0xC0, 0x0D, 0x80, 0x8F, 0x05, 0x80, 0x70, 0x0B, 0x80, 0x37,
+    0x26, 0x80, 0x45, 0x12, 0x80, 0x52, 0x0F, 0x80, 0x5B, 0x01, 0x80, 0x53, 0x0A, 0x80, 0x4B, 0x11,
+    0x80, 0x23, 0x03, 0x80, 0x88, 0x03, 0x80, 0xCE, 0x24, 0x80, 0x5B, 0x0D, 0x80, 0x7A, 0x0B, 0x80,
+    0x18, 0xC0, 0x0D, 0x80, 0x90, 0x05, 0x80, 0x72, 0x0B, 0x80, 0x36, 0x26, 0x80, 0x41, 0x12, 0x80,
+    0x50, 0x0F, 0x80, 0x58, 0x01, 0x80, 0x51, 0x01, 0x80, 0x9A, 0x07, 0x80, 0x49, 0x0A, 0x80, 0x73,
+    0x05, 0x80, 0x21, 0x03, 0x80, 0x86, 0x03, 0x80, 0xD0, 0x33, 0x80, 0x78, 0x0B, 0x80, 0x16, 0xC0,
+    0x0D, 0x80, 0x8E, 0x05, 0x80, 0x74, 0x0B, 0x80, 0x35, 0x26, 0x80, 0x3D, 0x12, 0x80, 0x4D, 0x0F,
+    0x80, 0x59, 0x01, 0x80, 0x4F, 0x01, 0x80, 0x97, 0x07, 0x80, 0x46, 0x11, 0x80, 0x1F, 0x08, 0x80,
+    0xD4, 0x24, 0x80, 0x5A, 0x0D, 0x80, 0x75, 0x0B, 0x80, 0x15, 0xC0, 0x0D, 0x80, 0x8C, 0x05, 0x80,
+    0x76, 0x0B, 0x80, 0x34, 0x26, 0x80, 0x3A, 0x12, 0x80, 0x4A, 0x0F, 0x80, 0x5A, 0x01, 0x80, 0x4D,
+    0x01, 0x80, 0x94, 0x07, 0x80, 0x44, 0x11, 0x80, 0x1D, 0x03, 0x80, 0x88, 0x03, 0x80, 0xD6, 0x24,
+    0x80, 0x59, 0x0D, 0x80, 0x73, 0x0B, 0x80, 0x13, 0xC0, 0x0D, 0x80, 0x89, 0x05, 0x80, 0x78, 0x0B,
+    0x80, 0x32, 0x26, 0x80, 0x36, 0x12, 0x80, 0x47, 0x0F, 0x80, 0x5C, 0x01, 0x80, 0x4B, 0x01, 0x80,
+    0x90, 0x07, 0x80, 0x41, 0x11, 0x80, 0x1B, 0x08, 0x80, 0xDA, 0x33, 0x80, 0x70, 0x0B, 0x80, 0x11,
+    0xC0, 0x07, 0x80, 0xBF, 0x04, 0x80, 0x86, 0x05, 0x80, 0x79, 0x0B, 0x80, 0x31, 0x26, 0x80, 0x33,
+    0x12, 0x80, 0x44, 0x0F, 0x80, 0x5D, 0x01, 0x80, 0x49, 0x01, 0x80, 0x8D, 0x07, 0x80, 0x3F, 0x0A,
+    0x80, 0x72, 0x05, 0x80, 0x19, 0x03, 0x80, 0x89, 0x03, 0x80, 0xD8, 0x24, 0x80, 0x58, 0x0D, 0x80,
+    0x6E, 0x0B, 0x80, 0x0F, 0xC0, 0x07, 0x80, 0xB8, 0x04, 0x80, 0x83, 0x05, 0x80, 0x7B, 0x0B, 0x80,
+    0x30, 0x26, 0x80, 0x30, 0x12, 0x80, 0x42, 0x0F, 0x80, 0x5E, 0x01, 0x80, 0x47, 0x01, 0x80, 0x8A,
+    0x07, 0x80, 0x3C, 0x11, 0x80, 0x17, 0x03, 0x80, 0x8A, 0x03, 0x80, 0xD3, 0x33, 0x80, 0x6B, 0x0B,
+    0x80, 0x0E, 0xC0, 0x07, 0x80, 0xB1, 0x04, 0x80, 0x80, 0x05, 0x80, 0x7D, 0x0B, 0x80, 0x2F, 0x26,
+    0x80, 0x2F, 0x12, 0x80, 0x3F, 0x0F, 0x80, 0x60, 0x01, 0x80, 0x46, 0x01, 0x80, 0x86, 0x07, 0x80,
+    0x3A, 0x11, 0x80, 0x14, 0x03, 0x80, 0x8B, 0x03, 0x80, 0xCE, 0x24, 0x80, 0x57, 0x0D, 0x80, 0x69,
+    0x0B, 0x80, 0x0C, 0xC0, 0x07, 0x80, 0xAA, 0x04, 0x80, 0x7D, 0x05, 0x80, 0x7E, 0x0B, 0x80, 0x2D,
+    0x26, 0x80, 0x2E, 0x12, 0x80, 0x3C, 0x0F, 0x80, 0x61, 0x04, 0x80, 0x83, 0x07, 0x80, 0x38, 0x11,
+    0x80, 0x12, 0x03, 0x80, 0x8C, 0x03, 0x80, 0xC9, 0x33, 0x80, 0x66, 0x0B, 0x80, 0x0A, 0xC0, 0x07,
+    0x80, 0xA3, 0x04, 0x80, 0x7B, 0x05, 0x80, 0x80, 0x0B, 0x80, 0x2C, 0x26, 0x80, 0x2C, 0x12, 0x80,
+    0x3A, 0x0F, 0x80, 0x62, 0x04, 0x80, 0x80, 0x07, 0x80, 0x37, 0x11, 0x80, 0x0F, 0x03, 0x80, 0x8D,
+    0x03, 0x80, 0xC5, 0x24, 0x80, 0x56, 0x0D, 0x80, 0x64, 0x0B, 0x80, 0x09, 0xC0, 0x07, 0x80, 0x9C,
+    0x04, 0x80, 0x78, 0x05, 0x80, 0x82, 0x0B, 0x80, 0x2B, 0x26, 0x80, 0x2B, 0x12, 0x80, 0x37, 0x0F,
+    0x80, 0x63, 0x04, 0x80, 0x7D, 0x07, 0x80, 0x36, 0x0A, 0x80, 0x71, 0x05, 0x80, 0x0D, 0x08, 0x80,
+    0xC0, 0x33, 0x80, 0x62, 0x0B, 0x80, 0x07, 0xC0, 0x07, 0x80, 0x96, 0x04, 0x80, 0x75, 0x05, 0x80,
+    0x7E, 0x0B, 0x80, 0x29, 0x26, 0x80, 0x29, 0x12, 0x80, 0x35, 0x0F, 0x80, 0x65, 0x04, 0x80, 0x79,
+    0x07, 0x80, 0x35, 0x11, 0x80, 0x09, 0x03, 0x80, 0x8F, 0x03, 0x80, 0xBB, 0x24, 0x80, 0x55, 0x0D,
+    0x80, 0x60, 0x0B, 0x80, 0x06, 0xC0, 0x07, 0x80, 0x8F, 0x04, 0x80, 0x72, 0x05, 0x80, 0x7B, 0x0B,
+    0x80, 0x28, 0x26, 0x80, 0x27, 0x12, 0x80, 0x33, 0x0C, 0x80, 0xA7, 0x01, 0x80, 0x66, 0x01, 0x80,
+    0x47, 0x01, 0x80, 0x76, 0x1A, 0x80, 0x06, 0x08, 0x80, 0xB6, 0x24, 0x80, 0x54, 0x0D, 0x80, 0x5D,
+    0x0B, 0x80, 0x04, 0xC0, 0x07, 0x80, 0x8A, 0x04, 0x80, 0x70, 0x05, 0x80, 0x78, 0x0B, 0x80, 0x26,
+    0x26, 0x80, 0x25, 0x12, 0x80, 0x30, 0x0C, 0x80, 0xA9, 0x01, 0x80, 0x67, 0x04, 0x80, 0x73, 0x07,
+    0x80, 0x34, 0x0A, 0x80, 0x70, 0x05, 0x80, 0x03, 0x03, 0x80, 0x90, 0x03, 0x80, 0xB2, 0x33, 0x80,
+    0x5B, 0x0B, 0x80, 0x03, 0xC0, 0x07, 0x80, 0x8C, 0x04, 0x80, 0x6D, 0x05, 0x80, 0x74, 0x0B, 0x80,
+    0x25, 0x26, 0x80, 0x24, 0x12, 0x80, 0x2E, 0x0C, 0x80, 0xAB, 0x01, 0x80, 0x68, 0x04, 0x80, 0x70,
+    0x07, 0x80, 0x33, 0x11, 0x44, 0x00, 0x80, 0x91, 0x03, 0x80, 0xAD, 0x24, 0x80, 0x53, 0x0D, 0x80,
+    0x59, 0x0B, 0x80, 0x01, 0xC0, 0x07, 0x80, 0x8D, 0x04, 0x80, 0x6A, 0x05, 0x80, 0x71, 0x0B, 0x80,
+    0x23, 0x26, 0x80, 0x21, 0x12, 0x80, 0x2C, 0x0C, 0x80, 0xAD, 0x01, 0x80, 0x64, 0x04, 0x80, 0x6D,
+    0x07, 0x80, 0x32, 0x16, 0x80, 0x92, 0x03, 0x80, 0xA9, 0x24, 0x80, 0x52, 0x0D, 0x80, 0x57, 0x0B,
+    0x42, 0x00, 0x07, 0x80, 0x8F, 0x04, 0x80, 0x68, 0x05, 0x80, 0x6D, 0x0B, 0x80, 0x22, 0x26, 0x80,
+    0x1F, 0x12, 0x80, 0x29, 0x0C, 0x80, 0xAE, 0x01, 0x80, 0x62, 0x04, 0x80, 0x6C, 0x07, 0x80, 0x31,
+    0x1B, 0x80, 0xA4, 0x33, 0x80, 0x55, 0xC0, 0x07, 0x80, 0x90, 0x04, 0x80, 0x65, 0x05, 0x80, 0x6A,
+    0x0B, 0x80, 0x20, 0x26, 0x80, 0x1D, 0x12, 0x80, 0x27, 0x0C, 0x80, 0xB0, 0x01, 0x80, 0x5F, 0x04,
+    0x80, 0x6D, 0x07, 0x80, 0x2F, 0x0A, 0x80, 0x6F, 0x0A, 0x80, 0x93, 0x03, 0x80, 0xA0, 0x24, 0x80,
+    0x51, 0x0D, 0x80, 0x54, 0xC0, 0x07, 0x80, 0x91, 0x04, 0x80, 0x63, 0x05, 0x80, 0x67, 0x0B, 0x80,
+    0x1F, 0x26, 0x80, 0x1B, 0x12, 0x80, 0x25, 0x0C, 0x80, 0xB1, 0x01, 0x80, 0x5C, 0x01, 0x80, 0x48,
+    0x01, 0x80, 0x6F, 0x07, 0x80, 0x2E, 0x1B, 0x80, 0x9C, 0x33, 0x80, 0x53, 0xC0, 0x07, 0x80, 0x92,
+    0x04, 0x80, 0x60, 0x05, 0x80, 0x64, 0x0B, 0x80, 0x1D, 0x26, 0x80, 0x18, 0x12, 0x80, 0x24, 0x0C,
+    0x80, 0xB3, 0x01, 0x80, 0x59, 0x04, 0x80, 0x70, 0x07, 0x80, 0x2D, 0x16, 0x80, 0x94, 0x03, 0x80,
+    0x9A, 0x24, 0x80, 0x50, 0x0D, 0x80, 0x52, 0xC0, 0x07, 0x80, 0x93, 0x04, 0x80, 0x5F, 0x05, 0x80,
+    0x61, 0x0B, 0x80, 0x1B, 0x26, 0x80, 0x15, 0x12, 0x80, 0x23, 0x0C, 0x80, 0xB4, 0x01, 0x80, 0x56,
+    0x04, 0x80, 0x72, 0x07, 0x80, 0x2C, 0x0A, 0x80, 0x6E, 0x0A, 0x80, 0x95, 0x03, 0x80, 0x9D, 0x24,
+    0x80, 0x4F, 0x0D, 0x80, 0x51, 0xC0, 0x07, 0x80, 0x94, 0x04, 0x80, 0x60, 0x05, 0x80, 0x5D, 0x0B,
+    0x80, 0x1A, 0x0F, 0x80, 0xB0, 0x15, 0x80, 0x12, 0x12, 0x80, 0x22, 0x0C, 0x80, 0xB6, 0x01, 0x80,
+    0x53, 0x04, 0x80, 0x73, 0x07, 0x80, 0x2B, 0x1B, 0x80, 0xA0, 0x33, 0x80, 0x50, 0xC0, 0x07, 0x80,
+    0x95, 0x04, 0x80, 0x61, 0x05, 0x80, 0x5A, 0x0B, 0x80, 0x18, 0x26, 0x80, 0x0F, 0x12, 0x80, 0x21,
+    0x0C, 0x80, 0xB8, 0x01, 0x80, 0x51, 0x04, 0x80, 0x74, 0x07, 0x80, 0x29, 0x16, 0x80, 0x96, 0x03,
+    0x80, 0xA3, 0x24, 0x80, 0x4E, 0x0D, 0x80, 0x4F, 0xC0, 0x0D, 0x80, 0x62, 0x05, 0x80, 0x58, 0x0B,
+    0x80, 0x16, 0x0F, 0x80, 0xAD, 0x15, 0x80, 0x0C, 0x12, 0x80, 0x20, 0x0C, 0x80, 0xB4, 0x01, 0x80,
+    0x4E, 0x04, 0x80, 0x75, 0x07, 0x80, 0x28, 0x0A, 0x80, 0x6D, 0x0A, 0x80, 0x97, 0x03, 0x80, 0xA5,
+    0x24, 0x80, 0x4D, 0x0D, 0x80, 0x4E, 0xC0, 0x0D, 0x80, 0x63, 0x05, 0x80, 0x59, 0x0B, 0x80, 0x14,
+    0x0F, 0x80, 0xA7, 0x15, 0x80, 0x09, 0x12, 0x80, 0x1F, 0x0C, 0x80, 0xB1, 0x01, 0x80, 0x4B, 0x04,
+    0x80, 0x77, 0x07, 0x80, 0x27, 0x1B, 0x80, 0xA8, 0x33, 0x80, 0x4D, 0xC0, 0x07, 0x80, 0x92, 0x0B,
+    0x80, 0x5B, 0x0B, 0x80, 0x13, 0x0F, 0x80, 0xA2, 0x15, 0x80, 0x06, 0x12, 0x80, 0x1D, 0x0C, 0x80,
+    0xAD, 0x01, 0x80, 0x49, 0x04, 0x80, 0x78, 0x07, 0x80, 0x25, 0x0A, 0x80, 0x6C, 0x0A, 0x80, 0x98,
+    0x03, 0x80, 0xAA, 0x24, 0x80, 0x4C, 0x0D, 0x80, 0x4C, 0xC0, 0x07, 0x80, 0x8C, 0x04, 0x80, 0x64,
+    0x05, 0x80, 0x5C, 0x0B, 0x80, 0x10, 0x0F, 0x80, 0x9D, 0x15, 0x80, 0x03, 0x0B, 0x80, 0x92, 0x05,
+    0x80, 0x1C, 0x0C, 0x80, 0xAA, 0x01, 0x80, 0x46, 0x01, 0x80, 0x47, 0x01, 0x80, 0x79, 0x07, 0x80,
+    0x24, 0x1B, 0x80, 0xAD, 0x24, 0x80, 0x4A, 0x0D, 0x80, 0x4B, 0xC0, 0x07, 0x80, 0x86, 0x04, 0x80,
+    0x65, 0x05, 0x80, 0x5E, 0x0B, 0x80, 0x0E, 0x0F, 0x80, 0x98, 0x15, 0x4C, 0x00, 0x80, 0x90, 0x05,
+    0x80, 0x1B, 0x0C, 0x80, 0xA7, 0x01, 0x80, 0x44, 0x04, 0x80, 0x7A, 0x07, 0x80, 0x22, 0x16, 0x80,
+    0x97, 0x03, 0x80, 0xB0, 0x24, 0x80, 0x49, 0x0D, 0x80, 0x4A, 0xC0, 0x07, 0x80, 0x80, 0x04, 0x80,
+    0x66, 0x05, 0x80, 0x5F, 0x0B, 0x80, 0x0C, 0x0F, 0x80, 0x93, 0x22, 0x80, 0x8F, 0x05, 0x80, 0x1A,
+    0x0C, 0x80, 0xA4, 0x01, 0x80, 0x45, 0x04, 0x80, 0x7B, 0x07, 0x80, 0x21, 0x0A, 0x80, 0x6B, 0x0A,
+    0x80, 0x95, 0x03, 0x80, 0xB3, 0x05, 0x80, 0xA1, 0x1D, 0x80, 0x48, 0x0D, 0x80, 0x49, 0xC0, 0x07,
+    0x80, 0x7B, 0x0B, 0x80, 0x60, 0x0B, 0x80, 0x0A, 0x0F, 0x80, 0x8E, 0x22, 0x80, 0x8D, 0x05, 0x81,
+    0x18, 0xE3, 0x0B, 0x80, 0xA0, 0x01, 0x80, 0x46, 0x01, 0x80, 0x46, 0x01, 0x80, 0x7C, 0x07, 0x80,
+    0x1F, 0x16, 0x80, 0x92, 0x03, 0x80, 0xB5, 0x24, 0x80, 0x46, 0x0D, 0x80, 0x48, 0xC0, 0x07, 0x80,
+    0x75, 0x04, 0x80, 0x67, 0x05, 0x80, 0x61, 0x0B, 0x80, 0x08, 0x0F, 0x80, 0x89, 0x22, 0x80, 0x8C,
+    0x05, 0x81, 0x17, 0xE5, 0x0B, 0x80, 0x9D, 0x01, 0x80, 0x47, 0x01, 0x80, 0x44, 0x01, 0x80, 0x7D,
+    0x07, 0x80, 0x1E, 0x0A, 0x80, 0x6A, 0x0A, 0x80, 0x90, 0x03, 0x80, 0xB7, 0x05, 0x80, 0xA2, 0x1D,
+    0x80, 0x45, 0x0D, 0x80, 0x47, 0xC0, 0x07, 0x80, 0x70, 0x04, 0x80, 0x68, 0x05, 0x80, 0x63, 0x0B,
+    0x80, 0x06, 0x0F, 0x80, 0x85, 0x22, 0x80, 0x8A, 0x05, 0x81, 0x15, 0xE6, 0x0B, 0x80, 0x99, 0x01,
+    0x80, 0x48, 0x01, 0x80, 0x43, 0x01, 0x80, 0x7F, 0x07, 0x80, 0x1C, 0x16, 0x80, 0x8D, 0x03, 0x80,
+    0xBA, 0x24, 0x80, 0x44, 0x0D, 0x80, 0x45, 0xC0, 0x07, 0x80, 0x6A, 0x04, 0x80, 0x69, 0x05, 0x80,
+    0x64, 0x0B, 0x80, 0x04, 0x0F, 0x80, 0x80, 0x22, 0x80, 0x89, 0x05, 0x81, 0x14, 0xE8, 0x0B, 0x80,
+    0x96, 0x01, 0x80, 0x49, 0x01, 0x80, 0x41, 0x01, 0x80, 0x7E, 0x07, 0x80, 0x1A, 0x16, 0x80, 0x8B,
+    0x03, 0x80, 0xBC, 0x05, 0x80, 0xA3, 0x1D, 0x80, 0x43, 0x0D, 0x80, 0x44, 0xC0, 0x07, 0x80, 0x65,
+    0x0B, 0x80, 0x65, 0x0B, 0x80, 0x02, 0x0F, 0x80, 0x7B, 0x22, 0x80, 0x88, 0x05, 0x81, 0x12, 0xE9,
+    0x0B, 0x80, 0x93, 0x01, 0x80, 0x4A, 0x01, 0x80, 0x3F, 0x01, 0x80, 0x7B, 0x07, 0x80, 0x18, 0x0A,
+    0x80, 0x69, 0x0A, 0x80, 0x88, 0x03, 0x80, 0xBE, 0x24, 0x80, 0x41, 0x0D, 0x80, 0x43, 0xC0, 0x07,
+    0x80, 0x60, 0x04, 0x80, 0x6A, 0x05, 0x80, 0x66, 0x0B, 0x4B, 0x00, 0x80, 0xC0, 0x03, 0x80, 0x76,
+    0x29, 0x81, 0x10, 0xEA, 0x0B, 0x80, 0x90, 0x01, 0x80, 0x4B, 0x01, 0x80, 0x3D, 0x01, 0x80, 0x78,
+    0x07, 0x80, 0x16, 0x16, 0x80, 0x86, 0x03, 0x80, 0xB9, 0x05, 0x80, 0xA4, 0x1D, 0x80, 0x40, 0x0D,
+    0x80, 0x42, 0xC0, 0x07, 0x80, 0x5B, 0x0B, 0x80, 0x67, 0x17, 0x80, 0xC2, 0x03, 0x80, 0x72, 0x29,
+    0x81, 0x0F, 0xEB, 0x0B, 0x80, 0x8C, 0x04, 0x80, 0x3C, 0x01, 0x80, 0x75, 0x07, 0x80, 0x14, 0x0A,
+    0x80, 0x68, 0x0A, 0x80, 0x84, 0x03, 0x80, 0xB5, 0x24, 0x80, 0x3F, 0x0D, 0x80, 0x40, 0xC0, 0x07,
+    0x80, 0x56, 0x04, 0x80, 0x6B, 0x1E, 0x80, 0xC3, 0x03, 0x80, 0x6E, 0x29, 0x81, 0x0D, 0xEA, 0x0B,
+    0x80, 0x8A, 0x01, 0x80, 0x4C, 0x01, 0x80, 0x3A, 0x01, 0x80, 0x72, 0x07, 0x80, 0x12, 0x16, 0x80,
+    0x82, 0x03, 0x80, 0xB0, 0x24, 0x80, 0x3E, 0x0D, 0x80, 0x3F, 0xC0, 0x14, 0x80, 0x64, 0x17, 0x80,
+    0xC4, 0x03, 0x80, 0x6A, 0x29, 0x81, 0x0B, 0xE8, 0x0B, 0x80, 0x86, 0x01, 0x80, 0x4D, 0x01, 0x80,
+    0x38, 0x01, 0x80, 0x6F, 0x07, 0x80, 0x10, 0x0A, 0x80, 0x67, 0x0A, 0x80, 0x7F, 0x03, 0x80, 0xAC,
+    0x24, 0x80, 0x3D, 0x0D, 0x80, 0x3E, 0xC0, 0x0D, 0x80, 0x6C, 0x05, 0x80, 0x61, 0x17, 0x80, 0xC6,
+    0x03, 0x80, 0x65, 0x29, 0x81, 0x09, 0xE4, 0x0B, 0x80, 0x83, 0x04, 0x80, 0x37, 0x01, 0x80, 0x6D,
+    0x07, 0x80, 0x0E, 0x16, 0x80, 0x7D, 0x03, 0x80, 0xA8, 0x05, 0x80, 0xA5, 0x1D, 0x80, 0x3B, 0x0D,
+    0x80, 0x3C, 0xC0, 0x0D, 0x80, 0x69, 0x05, 0x80, 0x5E, 0x17, 0x80, 0xC7, 0x03, 0x80, 0x61, 0x29,
+    0x81, 0x07, 0xE2, 0x0B, 0x80, 0x80, 0x01, 0x80, 0x4E, 0x01, 0x80, 0x35, 0x01, 0x80, 0x6A, 0x07,
+    0x80, 0xAE, 0x0A, 0x80, 0x66, 0x0A, 0x80, 0x7B, 0x03, 0x80, 0xA4, 0x24, 0x80, 0x3A, 0x0D, 0x80,
+    0x3B, 0xC0, 0x0D, 0x80, 0x67, 0x05, 0x80, 0x5B, 0x17, 0x80, 0xC9, 0x03, 0x80, 0x5D, 0x22, 0x80,
+    0x87, 0x05, 0x81, 0x05, 0xDF, 0x0B, 0x80, 0x7D, 0x01, 0x80, 0x4D, 0x01, 0x80, 0x34, 0x01, 0x80,
+    0x67, 0x07, 0x80, 0xAB, 0x16, 0x80, 0x79, 0x03, 0x80, 0xA0, 0x05, 0x80, 0xA6, 0x1D, 0x80, 0x39,
+    0x0D, 0x80, 0x3A, 0xC0, 0x07, 0x80, 0x55, 0x04, 0x80, 0x64, 0x05, 0x80, 0x58, 0x1C, 0x80, 0x5A,
+    0x29, 0x81, 0x03, 0xDD, 0x0E, 0x80, 0x4A, 0x01, 0x80, 0x32, 0x01, 0x80, 0x64, 0x07, 0x80, 0xA8,
+    0x0A, 0x80, 0x65, 0x0A, 0x80, 0x76, 0x03, 0x80, 0x9C, 0x24, 0x80, 0x38, 0x0D, 0x80, 0x38, 0xC0,
+    0x0D, 0x80, 0x62, 0x05, 0x80, 0x56, 0x17, 0x80, 0xCB, 0x2E, 0x81, 0x01, 0xDC, 0x0B, 0x80, 0x7E,
+    0x01, 0x80, 0x48, 0x01, 0x80, 0x30, 0x01, 0x80, 0x62, 0x07, 0x80, 0xA5, 0x16, 0x80, 0x74, 0x03,
+    0x80, 0x98, 0x05, 0x80, 0xA7, 0x1D, 0x80, 0x37, 0x0D, 0x80, 0x37, 0xC0, 0x07, 0x80, 0x54, 0x04,
+    0x80, 0x60, 0x05, 0x80, 0x53, 0x17, 0x80, 0xCC, 0x03, 0x80, 0x59, 0x29, 0x81, 0x00, 0xDA, 0x0B,
+    0x80, 0x80, 0x01, 0x80, 0x46, 0x01, 0x80, 0x2F, 0x01, 0x80, 0x5F, 0x07, 0x80, 0xA2, 0x0A, 0x80,
+    0x64, 0x0A, 0x80, 0x72, 0x03, 0x80, 0x94, 0x24, 0x80, 0x35, 0x0D, 0x80, 0x35, 0xC0, 0x07, 0x80,
+    0x53, 0x04, 0x80, 0x5D, 0x05, 0x80, 0x50, 0x17, 0x80, 0xCD, 0x03, 0x80, 0x58, 0x2A, 0x80, 0xD6,
+    0x0B, 0x80, 0x81, 0x01, 0x80, 0x43, 0x01, 0x80, 0x2D, 0x01, 0x80, 0x5C, 0x07, 0x80, 0x9F, 0x16,
+    0x80, 0x70, 0x03, 0x80, 0x90, 0x24, 0x80, 0x34, 0x0D, 0x80, 0x34, 0xC0, 0x07, 0x80, 0x52, 0x04,
+    0x80, 0x5B, 0x05, 0x80, 0x4D, 0x17, 0x80, 0xCE, 0x03, 0x80, 0x57, 0x2A, 0x80, 0xD4, 0x0B, 0x80,
+    0x83, 0x01, 0x80, 0x41, 0x01, 0x80, 0x2C, 0x01, 0x80, 0x5A, 0x07, 0x80, 0x9C, 0x0A, 0x80, 0x63,
+    0x0A, 0x80, 0x6D, 0x03, 0x80, 0x8C, 0x24, 0x80, 0x33, 0x0D, 0x80, 0x32, 0xC0, 0x0D, 0x80, 0x59,
+    0x05, 0x80, 0x4B, 0x17, 0x80, 0xCF, 0x03, 0x80, 0x56, 0x2A, 0x80, 0xD0, 0x0B, 0x80, 0x84, 0x01,
+    0x80, 0x3F, 0x01, 0x80, 0x2B, 0x01, 0x80, 0x57, 0x07, 0x80, 0x99, 0x16, 0x80, 0x6C, 0x03, 0x80,
+    0x88, 0x05, 0x80, 0xA8, 0x1D, 0x80, 0x32, 0x0D, 0x80, 0x31, 0xC0, 0x07, 0x80, 0x50, 0x04, 0x80,
+    0x57, 0x05, 0x80, 0x48, 0x1C, 0x80, 0x55, 0x2A, 0x80, 0xCD, 0x0B, 0x80, 0x86, 0x01, 0x80, 0x3C,
+    0x01, 0x80, 0x29, 0x01, 0x80, 0x55, 0x07, 0x80, 0x96, 0x0A, 0x80, 0x62, 0x0A, 0x80, 0x69, 0x03,
+    0x80, 0x84, 0x24, 0x80, 0x31, 0x0D, 0x80, 0x2F, 0xC0, 0x07, 0x80, 0x4E, 0x04, 0x80, 0x54, 0x05,
+    0x80, 0x46, 0x17, 0x80, 0xC9, 0x03, 0x80, 0x54, 0x22, 0x80, 0x86, 0x06, 0x80, 0xCA, 0x0B, 0x80,
+    0x87, 0x01, 0x80, 0x3A, 0x01, 0x80, 0x28, 0x01, 0x80, 0x54, 0x07, 0x80, 0x93, 0x16, 0x80, 0x67,
+    0x03, 0x80, 0x86, 0x24, 0x80, 0x30, 0x0D, 0x80, 0x2E, 0xC0, 0x07, 0x80, 0x4A, 0x04, 0x80, 0x52,
+    0x05, 0x80, 0x45, 0x17, 0x80, 0xC5, 0x03, 0x80, 0x52, 0x2A, 0x80, 0xC7, 0x0B, 0x80, 0x88, 0x01,
+    0x80, 0x38, 0x01, 0x80, 0x26, 0x01, 0x80, 0x55, 0x07, 0x80, 0x90, 0x0A, 0x80, 0x61, 0x0A, 0x80,
+    0x65, 0x03, 0x80, 0x88, 0x24, 0x80, 0x2F, 0x0D, 0x80, 0x2C, 0xC0, 0x07, 0x80, 0x45, 0x04, 0x80,
+    0x50, 0x05, 0x80, 0x46, 0x17, 0x80, 0xC0, 0x03, 0x80, 0x51, 0x01, 0x80, 0xE0, 0x27, 0x80, 0xC3,
+    0x0B, 0x80, 0x89, 0x01, 0x80, 0x36, 0x01, 0x80, 0x25, 0x01, 0x80, 0x56, 0x07, 0x80, 0x8E, 0x0A,
+    0x80, 0x60, 0x0A, 0x80, 0x63, 0x03, 0x80, 0x8B, 0x05, 0x80, 0xA9, 0x1D, 0x80, 0x2E, 0x0D, 0x80,
+    0x2A, 0xC0, 0x07, 0x80, 0x41, 0x04, 0x80, 0x4E, 0x05, 0x80, 0x47, 0x17, 0x80, 0xBC, 0x03, 0x80,
+    0x50, 0x01, 0x80, 0xE3, 0x27, 0x80, 0xC1, 0x0B, 0x80, 0x8B, 0x01, 0x80, 0x34, 0x0D, 0x80, 0x8B,
+    0x16, 0x80, 0x61, 0x03, 0x80, 0x8D, 0x24, 0x80, 0x2C, 0x0D, 0x80, 0x29, 0xC0, 0x07, 0x80, 0x3C,
+    0x04, 0x80, 0x4C, 0x05, 0x80, 0x48, 0x17, 0x80, 0xB7, 0x03, 0x80, 0x4E, 0x01, 0x80, 0xE7, 0x27,
+    0x80, 0xBD, 0x0B, 0x80, 0x8C, 0x01, 0x80, 0x32, 0x04, 0x80, 0x57, 0x07, 0x80, 0x88, 0x0A, 0x80,
+    0x5F, 0x0A, 0x80, 0x5F, 0x03, 0x80, 0x8F, 0x24, 0x80, 0x2B, 0x0D, 0x80, 0x27, 0xC0, 0x07, 0x80,
+    0x39, 0x04, 0x80, 0x4A, 0x05, 0x80, 0x49, 0x17, 0x80, 0xB3, 0x03, 0x80, 0x4D, 0x01, 0x80, 0xEA,
+    0x1F, 0x80, 0x85, 0x06, 0x80, 0xBB, 0x0B, 0x80, 0x8D, 0x01, 0x80, 0x31, 0x04, 0x80, 0x58, 0x07,
+    0x80, 0x85, 0x1B, 0x80, 0x91, 0x24, 0x80, 0x2A, 0x0D, 0x80, 0x25, 0xC0, 0x07, 0x80, 0x34, 0x04,
+    0x80, 0x47, 0x1E, 0x80, 0xAE, 0x03, 0x80, 0x4B, 0x01, 0x80, 0xE6, 0x27, 0x80, 0xB7, 0x0B, 0x80,
+    0x8E, 0x01, 0x80, 0x32, 0x01, 0x80, 0x24, 0x01, 0x80, 0x59, 0x07, 0x80, 0x82, 0x0A, 0x80, 0x5E,
+    0x0A, 0x80, 0x60, 0x03, 0x80, 0x93, 0x05, 0x80, 0xAA, 0x1D, 0x80, 0x29, 0x0D, 0x80, 0x24, 0xC0,
+    0x07, 0x80, 0x31, 0x04, 0x80, 0x46, 0x05, 0x80, 0x4A, 0x17, 0x80, 0xAA, 0x03, 0x80, 0x49, 0x01,
+    0x80, 0xE1, 0x27, 0x80, 0xB5, 0x0B, 0x80, 0x8F, 0x07, 0x80, 0x5A, 0x07, 0x80, 0x80, 0x0A, 0x80,
+    0x5D, 0x0F, 0x80, 0x95, 0x24, 0x80, 0x28, 0x0D, 0x80, 0x22, 0xC0, 0x07, 0x80, 0x2D, 0x04, 0x80,
+    0x43, 0x05, 0x80, 0x4B, 0x17, 0x80, 0xA5, 0x03, 0x80, 0x48, 0x01, 0x80, 0xDD, 0x27, 0x80, 0xB1,
+    0x0B, 0x80, 0x90, 0x01, 0x80, 0x33, 0x0D, 0x80, 0x7D, 0x16, 0x80, 0x61, 0x03, 0x80, 0x97, 0x24,
+    0x80, 0x27, 0x0D, 0x80, 0x20, 0xC0, 0x07, 0x80, 0x29, 0x0B, 0x80, 0x4C, 0x17, 0x80, 0xA1, 0x03,
+    0x80, 0x46, 0x01, 0x80, 0xDB, 0x27, 0x80, 0xAF, 0x0B, 0x80, 0x92, 0x04, 0x80, 0x23, 0x01, 0x80,
+    0x5B, 0x07, 0x80, 0x7A, 0x0A, 0x80, 0x5C, 0x0F, 0x80, 0x99, 0x24, 0x80, 0x26, 0x0D, 0x80, 0x1E,
+    0xC0, 0x07, 0x80, 0x26, 0x04, 0x80, 0x44, 0x1E, 0x80, 0x9C, 0x03, 0x80, 0x44, 0x01, 0x80, 0xD5,
+    0x1F, 0x80, 0x84, 0x06, 0x80, 0xAB, 0x12, 0x80, 0xB1, 0x00, 0x80, 0x5C, 0x07, 0x80, 0x78, 0x1B,
+    0x80, 0x9B, 0x24, 0x80, 0x25, 0x0D, 0x80, 0x1D, 0xC0, 0x07, 0x80, 0x23, 0x0B, 0x80, 0x4D, 0x17,
+    0x80, 0x98, 0x03, 0x80, 0x42, 0x01, 0x80, 0xD0, 0x27, 0x80, 0xA9, 0x0E, 0x80, 0x34, 0x02, 0x80,
+    0xAE, 0x09, 0x80, 0x76, 0x0A, 0x80, 0x5B, 0x0A, 0x80, 0x62, 0x03, 0x80, 0x9D, 0x24, 0x80, 0x24,
+    0x0D, 0x80, 0x1B, 0xC0, 0x07, 0x80, 0x20, 0x04, 0x80, 0x45, 0x05, 0x80, 0x4E, 0x17, 0x81, 0x94,
+    0xBB, 0x02, 0x80, 0x3E, 0x01, 0x80, 0xCA, 0x27, 0x80, 0xA6, 0x0B, 0x80, 0x8F, 0x04, 0x81, 0x22,
+    0xAC, 0x00, 0x80, 0x5D, 0x07, 0x80, 0x77, 0x0A, 0x80, 0x59, 0x0F, 0x80, 0x9F, 0x05, 0x80, 0xAB,
+    0x1D, 0x80, 0x23, 0x0D, 0x80, 0x18, 0xC0, 0x07, 0x80, 0x1F, 0x24, 0x81, 0x90, 0xBA, 0x02, 0x80,
+    0x3A, 0x01, 0x80, 0xC5, 0x27, 0x80, 0xA3, 0x0B, 0x80, 0x8C, 0x05, 0x80, 0xA9, 0x00, 0x80, 0x5E,
+    0x07, 0x80, 0x78, 0x0A, 0x80, 0x58, 0x0A, 0x80, 0x63, 0x03, 0x80, 0xA1, 0x05, 0x80, 0xAA, 0x1D,
+    0x80, 0x22, 0x0D, 0x80, 0x16, 0xC0, 0x07, 0x80, 0x1D, 0x05, 0x80, 0xA9, 0x04, 0x80, 0x4D, 0x17,
+    0x81, 0x8C, 0xB9, 0x02, 0x80, 0x36, 0x01, 0x80, 0xC0, 0x1F, 0x80, 0x83, 0x06, 0x80, 0xA4, 0x0B,
+    0x80, 0x89, 0x04, 0x81, 0x21, 0xA7, 0x09, 0x80, 0x79, 0x0A, 0x80, 0x56, 0x0F, 0x80, 0x9F, 0x05,
+    0x80, 0xAB, 0x1D, 0x80, 0x21, 0x0D, 0x80, 0x14, 0xC0, 0x07, 0x80, 0x1C, 0x04, 0x81, 0x46, 0xA5,
+    0x04, 0x80, 0x4A, 0x17, 0x81, 0x88, 0xB8, 0x02, 0x80, 0x33, 0x01, 0x80, 0xBA, 0x27, 0x80, 0xA5,
+    0x0B, 0x80, 0x86, 0x05, 0x80, 0xA4, 0x00, 0x80, 0x5F, 0x07, 0x81, 0x7A, 0xB9, 0x09, 0x80, 0x55,
+    0x0F, 0x80, 0x9B, 0x24, 0x80, 0x20, 0x0D, 0x80, 0x12, 0xC0, 0x07, 0x80, 0x1A, 0x05, 0x80, 0xA6,
+    0x04, 0x80, 0x48, 0x17, 0x81, 0x84, 0xB7, 0x02, 0x80, 0x2F, 0x01, 0x80, 0xB5, 0x27, 0x80, 0xA7,
+    0x0B, 0x80, 0x84, 0x05, 0x80, 0xA2, 0x00, 0x80, 0x5E, 0x07, 0x81, 0x7B, 0xB5, 0x09, 0x80, 0x54,
+    0x0F, 0x80, 0x97, 0x24, 0x80, 0x1F, 0x0D, 0x80, 0x10, 0xC0, 0x07, 0x80, 0x18, 0x05, 0x80, 0xA7,
+    0x04, 0x80, 0x45, 0x17, 0x81, 0x80, 0xB6, 0x02, 0x80, 0x2C, 0x01, 0x80, 0xB0, 0x1F, 0x80, 0x82,
+    0x06, 0x80, 0xA8, 0x0B, 0x80, 0x80, 0x01, 0x80, 0x35, 0x01, 0x81, 0x20, 0xA0, 0x00, 0x80, 0x5C,
+    0x07, 0x81, 0x7C, 0xB1, 0x09, 0x80, 0x53, 0x0A, 0x80, 0x64, 0x03, 0x80, 0x94, 0x22, 0x80, 0x9B,
+    0x00, 0x80, 0x1E, 0x0D, 0x80, 0x0E, 0xC0, 0x07, 0x80, 0x16, 0x05, 0x80, 0xAA, 0x04, 0x80, 0x43,
+    0x17, 0x81, 0x81, 0xB5, 0x02, 0x80, 0x28, 0x01, 0x80, 0xAB, 0x27, 0x80, 0xA9, 0x0B, 0x80, 0x7E,
+    0x01, 0x80, 0x33, 0x02, 0x80, 0x9D, 0x00, 0x80, 0x59, 0x07, 0x81, 0x7D, 0xAD, 0x09, 0x80, 0x51,
+    0x0F, 0x80, 0x90, 0x22, 0x80, 0x97, 0x00, 0x80, 0x1D, 0x0D, 0x80, 0x0C, 0x01, 0x80, 0xD9, 0xC0,
+    0x07, 0x80, 0x14, 0x05, 0x80, 0xAC, 0x04, 0x80, 0x41, 0x18, 0x80, 0xB4, 0x02, 0x80, 0x25, 0x01,
+    0x80, 0xAF, 0x27, 0x80, 0xAA, 0x0B, 0x80, 0x7B, 0x01, 0x80, 0x31, 0x01, 0x81, 0x1F, 0x9B, 0x00,
+    0x80, 0x57, 0x07, 0x81, 0x7E, 0xA8, 0x09, 0x80, 0x50, 0x0F, 0x80, 0x8C, 0x22, 0x80, 0x94, 0x00,
+    0x80, 0x1C, 0x0D, 0x80, 0x0A, 0x01, 0x80, 0xD4, 0xC0, 0x07, 0x80, 0x11, 0x04, 0x81, 0x47, 0xAE,
+    0x04, 0x80, 0x3E, 0x17, 0x81, 0x82, 0xB3, 0x02, 0x80, 0x22, 0x01, 0x80, 0xB3, 0x27, 0x80, 0xAC,
+    0x0B, 0x80, 0x78, 0x01, 0x80, 0x2F, 0x01, 0x81, 0x1E, 0x99, 0x00, 0x80, 0x54, 0x07, 0x81, 0x7F,
+    0xA4, 0x09, 0x80, 0x4F, 0x0F, 0x80, 0x88, 0x22, 0x80, 0x90, 0x00, 0x80, 0x1B, 0x0D, 0x80, 0x08,
+    0x01, 0x80, 0xCF, 0xC0, 0x07, 0x80, 0x0F, 0x05, 0x80, 0xB0, 0x04, 0x80, 0x3C, 0x17, 0x81, 0x83,
+    0xB2, 0x02, 0x80, 0x1F, 0x01, 0x80, 0xB6, 0x1F, 0x80, 0x81, 0x06, 0x80, 0xAD, 0x0B, 0x80, 0x75,
+    0x01, 0x80, 0x2D, 0x02, 0x80, 0x96, 0x00, 0x80, 0x52, 0x07, 0x81, 0x80, 0xA0, 0x09, 0x80, 0x4D,
+    0x0F, 0x80, 0x85, 0x22, 0x80, 0x8D, 0x00, 0x80, 0x1A, 0x0D, 0x80, 0x06, 0x01, 0x80, 0xCA, 0xC0,
+    0x07, 0x80, 0x0C, 0x05, 0x80, 0xB2, 0x04, 0x80, 0x3A, 0x17, 0x81, 0x84, 0xB1, 0x02, 0x80, 0x1C,
+    0x01, 0x80, 0xBA, 0x27, 0x80, 0xAE, 0x01, 0x80, 0xA9, 0x08, 0x80, 0x73, 0x01, 0x80, 0x2B, 0x01,
+    0x81, 0x1D, 0x94, 0x00, 0x80, 0x50, 0x08, 0x80, 0x9D, 0x09, 0x80, 0x4C, 0x0F, 0x80, 0x81, 0x22,
+    0x80, 0x89, 0x00, 0x80, 0x19, 0x0D, 0x80, 0x04, 0x01, 0x80, 0xC5, 0xC0, 0x07, 0x80, 0x0A, 0x05,
+    0x80, 0xB4, 0x04, 0x80, 0x38, 0x18, 0x80, 0xAF, 0x02, 0x80, 0x19, 0x01, 0x80, 0xBD, 0x27, 0x80,
+    0xAF, 0x01, 0x80, 0xA8, 0x08, 0x80, 0x70, 0x01, 0x80, 0x29, 0x02, 0x80, 0x92, 0x00, 0x80, 0x4E,
+    0x07, 0x81, 0x81, 0x99, 0x09, 0x80, 0x4B, 0x0A, 0x80, 0x65, 0x03, 0x80, 0x7E, 0x05, 0x80, 0xA9,
+    0x1B, 0x80, 0x86, 0x00, 0x80, 0x18, 0x0D, 0x80, 0x02, 0x01, 0x80, 0xC0, 0xC0, 0x07, 0x80, 0x06,
+    0x05, 0x80, 0xB6, 0x04, 0x80, 0x35, 0x17, 0x81, 0x85, 0xAE, 0x02, 0x80, 0x16, 0x01, 0x80, 0xC1,
+    0x1F, 0x80, 0x80, 0x06, 0x80, 0xB1, 0x0B, 0x80, 0x6D, 0x01, 0x80, 0x27, 0x01, 0x80, 0x1B, 0x01,
+    0x80, 0x4B, 0x07, 0x81, 0x82, 0x95, 0x09, 0x80, 0x4A, 0x05, 0x80, 0xA5, 0x08, 0x80, 0x7A, 0x05,
+    0x80, 0xA7, 0x1B, 0x80, 0x83, 0x00, 0x80, 0x17, 0x0D, 0x42, 0x00, 0x80, 0xBB, 0xC0, 0x07, 0x80,
+    0x03, 0x05, 0x80, 0xB8, 0x04, 0x80, 0x33, 0x18, 0x80, 0xAC, 0x02, 0x80, 0x13, 0x01, 0x80, 0xC4,
+    0x2A, 0x80, 0xA7, 0x08, 0x80, 0x6B, 0x01, 0x80, 0x26, 0x01, 0x81, 0x1A, 0x93, 0x00, 0x80, 0x49,
+    0x07, 0x81, 0x83, 0x93, 0x09, 0x80, 0x48, 0x05, 0x80, 0xA0, 0x08, 0x80, 0x77, 0x05, 0x80, 0xA5,
+    0x1B, 0x80, 0x80, 0x00, 0x80, 0x16, 0x10, 0x80, 0xB7, 0xC0, 0x07, 0x45, 0x00, 0x00, 0x80, 0xBA,
+    0x04, 0x80, 0x31, 0x1C, 0x80, 0x10, 0x01, 0x80, 0xC8, 0x1F, 0x80, 0x7F, 0x06, 0x80, 0xB3, 0x01,
+    0x80, 0xA6, 0x08, 0x80, 0x68, 0x01, 0x80, 0x24, 0x01, 0x80, 0x19, 0x01, 0x80, 0x47, 0x07, 0x81,
+    0x84, 0x94, 0x09, 0x80, 0x47, 0x05, 0x80, 0x9C, 0x08, 0x80, 0x73, 0x05, 0x80, 0xA3, 0x1B, 0x80,
+    0x7D, 0x00, 0x80, 0x15, 0x10, 0x80, 0xB1, 0xC0, 0x0D, 0x81, 0x46, 0xBC, 0x04, 0x80, 0x32, 0x18,
+    0x80, 0xAA, 0x02, 0x80, 0x0E, 0x01, 0x80, 0xCB, 0x27, 0x80, 0xB4, 0x01, 0x80, 0xA5, 0x08, 0x80,
+    0x65, 0x01, 0x80, 0x22, 0x01, 0x81, 0x17, 0x94, 0x00, 0x80, 0x45, 0x08, 0x80, 0x95, 0x09, 0x80,
+    0x46, 0x05, 0x80, 0x98, 0x08, 0x80, 0x70, 0x05, 0x80, 0xA1, 0x1B, 0x80, 0x7A, 0x00, 0x80, 0x14,
+    0x10, 0x80, 0xAD, 0xC0, 0x0D, 0x81, 0x44, 0xBE, 0x1D, 0x81, 0x86, 0xA9, 0x02, 0x80, 0x0B, 0x01,
+    0x80, 0xCE, 0x27, 0x80, 0xB5, 0x01, 0x80, 0xA4, 0x08, 0x80, 0x63, 0x01, 0x80, 0x21, 0x01, 0x81,
+    0x16, 0x95, 0x00, 0x80, 0x43, 0x07, 0x80, 0x85, 0x0A, 0x80, 0x45, 0x05, 0x80, 0x94, 0x08, 0x80,
+    0x6F, 0x05, 0x80, 0x9F, 0x1B, 0x80, 0x7B, 0x12, 0x80, 0xB0, 0xC0, 0x0D, 0x81, 0x42, 0xC0, 0x1E,
+    0x80, 0xA7, 0x02, 0x80, 0x09, 0x01, 0x80, 0xD2, 0x1F, 0x80, 0x7E, 0x06, 0x80, 0xB6, 0x01, 0x80,
+    0xA3, 0x08, 0x80, 0x61, 0x01, 0x80, 0x1F, 0x01, 0x80, 0x15, 0x01, 0x80, 0x41, 0x07, 0x81, 0x86,
+    0x96, 0x09, 0x80, 0x43, 0x05, 0x80, 0x90, 0x08, 0x80, 0x71, 0x05, 0x80, 0x9D, 0x1B, 0x80, 0x7A,
+    0x00, 0x80, 0x13, 0x10, 0x80, 0xB3, 0xC0, 0x0D, 0x81, 0x40, 0xC2, 0x04, 0x80, 0x33, 0x18, 0x80,
+    0xA6, 0x02, 0x80, 0x06, 0x01, 0x80, 0xD5, 0x27, 0x80, 0xB7, 0x01, 0x80, 0xA2, 0x08, 0x80, 0x62,
+    0x01, 0x80, 0x1E, 0x01, 0x81, 0x14, 0x96, 0x00, 0x80, 0x3E, 0x08, 0x80, 0x97, 0x09, 0x80, 0x42,
+    0x05, 0x80, 0x8C, 0x08, 0x80, 0x73, 0x05, 0x80, 0x9B, 0x1B, 0x80, 0x7B, 0x00, 0x80, 0x12, 0x10,
+    0x80, 0xB6, 0xC0, 0x0D, 0x81, 0x3F, 0xC3, 0x1E, 0x80, 0xA4, 0x02, 0x80, 0x04, 0x01, 0x80, 0xD6,
+    0x27, 0x80, 0xB8, 0x01, 0x80, 0xA1, 0x08, 0x80, 0x63, 0x04, 0x81, 0x13, 0x97, 0x00, 0x80, 0x3C,
+    0x01, 0x80, 0x85, 0x04, 0x80, 0x87, 0x0A, 0x80, 0x41, 0x05, 0x80, 0x88, 0x03, 0x80, 0x62, 0x03,
+    0x80, 0x75, 0x05, 0x80, 0x99, 0x1B, 0x80, 0x7A, 0x00, 0x80, 0x11, 0x10, 0x80, 0xB9, 0xC0, 0x0D,
+    0x81, 0x3D, 0xC6, 0x04, 0x80, 0x34, 0x18, 0x80, 0xA3, 0x02, 0x80, 0x02, 0x01, 0x80, 0xD0, 0x1F,
+    0x80, 0x7D, 0x06, 0x80, 0xB9, 0x01, 0x80, 0x9F, 0x0E, 0x80, 0x11, 0x01, 0x80, 0x3B, 0x01, 0x80,
+    0x83, 0x04, 0x81, 0x88, 0x98, 0x09, 0x80, 0x40, 0x05, 0x80, 0x84, 0x03, 0x80, 0x61, 0x03, 0x80,
+    0x76, 0x05, 0x80, 0x97, 0x1B, 0x80, 0x7B, 0x00, 0x80, 0x10, 0x10, 0x80, 0xBC, 0xC0, 0x0D, 0x81,
+    0x3B, 0xC7, 0x1E, 0x80, 0xA1, 0x02, 0x42, 0x00, 0x80, 0xCB, 0x27, 0x80, 0xBA, 0x01, 0x80, 0x9E,
+    0x08, 0x80, 0x65, 0x04, 0x81, 0x10, 0x98, 0x00, 0x80, 0x3C, 0x01, 0x80, 0x81, 0x04, 0x80, 0x85,
+    0x0A, 0x80, 0x3F, 0x05, 0x80, 0x80, 0x03, 0x80, 0x5E, 0x03, 0x80, 0x78, 0x05, 0x80, 0x96, 0x1B,
+    0x80, 0x7A, 0x00, 0x80, 0x0F, 0x10, 0x80, 0xBF, 0xC0, 0x0D, 0x80, 0x39, 0x1F, 0x80, 0x9F, 0x05,
+    0x80, 0xC6, 0x1F, 0x80, 0x7C, 0x06, 0x80, 0xBB, 0x01, 0x80, 0x9D, 0x0B, 0x80, 0x1D, 0x01, 0x80,
+    0x0F, 0x04, 0x80, 0x7F, 0x04, 0x80, 0x83, 0x0A, 0x80, 0x3D, 0x05, 0x80, 0x7D, 0x03, 0x80, 0x5D,
+    0x03, 0x80, 0x7A, 0x05, 0x80, 0x93, 0x1D, 0x80, 0x0E, 0x10, 0x80, 0xC3, 0xC0, 0x0D, 0x81, 0x37,
+    0xC3, 0x1E, 0x80, 0x9D, 0x05, 0x80, 0xC1, 0x27, 0x80, 0xBC, 0x01, 0x80, 0x9C, 0x08, 0x80, 0x66,
+    0x04, 0x81, 0x0E, 0x99, 0x00, 0x80, 0x3D, 0x01, 0x80, 0x7D, 0x04, 0x81, 0x80, 0x99, 0x09, 0x80,
+    0x3C, 0x05, 0x80, 0x79, 0x03, 0x80, 0x5B, 0x03, 0x80, 0x7B, 0x05, 0x80, 0x92, 0x1D, 0x80, 0x0D,
+    0x10, 0x80, 0xC5, 0xC0, 0x0D, 0x81, 0x36, 0xBF, 0x1D, 0x81, 0x83, 0x9C, 0x05, 0x80, 0xBC, 0x1F,
+    0x80, 0x7B, 0x06, 0x80, 0xBD, 0x01, 0x80, 0x9A, 0x08, 0x80, 0x67, 0x04, 0x81, 0x0D, 0x9A, 0x09,
+    0x80, 0x7E, 0x0A, 0x80, 0x3B, 0x05, 0x80, 0x75, 0x03, 0x80, 0x59, 0x03, 0x80, 0x7D, 0x05, 0x80,
+    0x90, 0x2F, 0x80, 0xC9, 0x05, 0x80, 0x93, 0xC0, 0x0D, 0x81, 0x34, 0xBC, 0x04, 0x80, 0x35, 0x17,
+    0x81, 0x80, 0x9A, 0x05, 0x80, 0xB7, 0x2A, 0x80, 0x99, 0x08, 0x80, 0x68, 0x04, 0x80, 0x0C, 0x04,
+    0x80, 0x7C, 0x04, 0x80, 0x7B, 0x0A, 0x80, 0x3A, 0x05, 0x80, 0x71, 0x03, 0x80, 0x57, 0x03, 0x80,
+    0x7E, 0x05, 0x80, 0x8E, 0x1B, 0x80, 0x79, 0x00, 0x80, 0x0C, 0x10, 0x80, 0xCB, 0xC0, 0x0D, 0x81,
+    0x32, 0xB8, 0x1D, 0x81, 0x7C, 0x99, 0x05, 0x80, 0xB2, 0x27, 0x80, 0xBF, 0x01, 0x80, 0x97, 0x08,
+    0x80, 0x69, 0x04, 0x81, 0x0B, 0x9B, 0x00, 0x80, 0x3E, 0x01, 0x80, 0x7B, 0x04, 0x80, 0x79, 0x0A,
+    0x80, 0x39, 0x05, 0x80, 0x6E, 0x03, 0x80, 0x55, 0x03, 0x80, 0x80, 0x05, 0x80, 0x8C, 0x1D, 0x80,
+    0x0B, 0x10, 0x80, 0xCF, 0x05, 0x80, 0x94, 0xC0, 0x0D, 0x81, 0x31, 0xB5, 0x1D, 0x81, 0x79, 0x96,
+    0x05, 0x80, 0xAD, 0x1F, 0x80, 0x7A, 0x09, 0x80, 0x96, 0x0B, 0x80, 0x1C, 0x01, 0x80, 0x0A, 0x04,
+    0x80, 0x7A, 0x04, 0x80, 0x76, 0x0A, 0x80, 0x38, 0x05, 0x80, 0x6D, 0x03, 0x80, 0x53, 0x03, 0x80,
+    0x81, 0x05, 0x80, 0x8A, 0x1D, 0x80, 0x0A, 0x10, 0x80, 0xD1, 0xC0, 0x0D, 0x81, 0x2F, 0xB1, 0x04,
+    0x80, 0x32, 0x17, 0x81, 0x75, 0x95, 0x05, 0x80, 0xA8, 0x27, 0x80, 0xBB, 0x01, 0x80, 0x94, 0x08,
+    0x80, 0x6A, 0x04, 0x81, 0x09, 0x9C, 0x03, 0x80, 0x79, 0x04, 0x81, 0x74, 0x9A, 0x09, 0x80, 0x36,
+    0x0A, 0x80, 0x52, 0x03, 0x80, 0x83, 0x05, 0x80, 0x88, 0x1B, 0x80, 0x78, 0x00, 0x80, 0x09, 0x10,
+    0x80, 0xD4, 0xC0, 0x0D, 0x81, 0x2D, 0xAE, 0x04, 0x80, 0x31, 0x17, 0x81, 0x71, 0x93, 0x05, 0x80,
+    0xA4, 0x1F, 0x80, 0x79, 0x06, 0x80, 0xB9, 0x01, 0x80, 0x93, 0x08, 0x80, 0x6B, 0x04, 0x80, 0x08,
+    0x04, 0x80, 0x78, 0x04, 0x80, 0x72, 0x0A, 0x80, 0x35, 0x05, 0x80, 0x6E, 0x03, 0x80, 0x50, 0x03,
+    0x80, 0x84, 0x05, 0x80, 0x87, 0x2F, 0x80, 0xD7, 0x05, 0x80, 0x95, 0xC0, 0x0D, 0x81, 0x2C, 0xAA,
+    0x04, 0x80, 0x2F, 0x17, 0x81, 0x6E, 0x91, 0x05, 0x80, 0x9F, 0x27, 0x80, 0xB6, 0x01, 0x80, 0x91,
+    0x0B, 0x80, 0x1B, 0x01, 0x81, 0x07, 0x9D, 0x00, 0x80, 0x3F, 0x01, 0x80, 0x77, 0x04, 0x80, 0x6F,
+    0x0A, 0x80, 0x34, 0x0A, 0x80, 0x4E, 0x0A, 0x80, 0x85, 0x15, 0x80, 0xC1, 0x06, 0x80, 0x08, 0x10,
+    0x80, 0xD4, 0xC0, 0x0D, 0x81, 0x2A, 0xA7, 0x04, 0x80, 0x2D, 0x17, 0x81, 0x6A, 0x8F, 0x05, 0x80,
+    0x9A, 0x1F, 0x80, 0x78, 0x06, 0x80, 0xB3, 0x01, 0x80, 0x8F, 0x08, 0x80, 0x6C, 0x01, 0x80, 0x1A,
+    0x01, 0x80, 0x06, 0x04, 0x80, 0x76, 0x04, 0x80, 0x6D, 0x0A, 0x80, 0x33, 0x05, 0x80, 0x6F, 0x03,
+    0x80, 0x4C, 0x03, 0x80, 0x81, 0x05, 0x80, 0x83, 0x15, 0x80, 0xBE, 0x04, 0x80, 0x77, 0x00, 0x80,
+    0x07, 0x10, 0x80, 0xD0, 0xC0,
+};
+
+#endif  // CLIPS_STARS_H_
@@ -0,0 +1,238 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Layering of effects on top of each other.                                    *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef COMPOSITOR_H_
+#define COMPOSITOR_H_
+
+#include "effect.h"  // Abstract effect structure.
+
+
+/**
+ * How a layer is combined with the ones below it.
+ */
+enum Blend : uint8_t {
+    BLEND_ALPHA,   // Cover the layers below, letting `amount` out of 256 of the layer through.
+    BLEND_ADD,     // Add up the channels, saturating.
+    BLEND_SCREEN,  // Like adding, but brightening less what is already bright.
+    BLEND_MAX,     // Keep the brightest of each channel.
+};
+
+/**
+ * A layer of a composed effect.
+ *
+ * @param T The effect to be shown. It has to expose its per pixel part as `Kernel`,
+ *          with the `call(n, i, j)` of a LinearFillCallback and an `update()` that
+ *          moves it to the next frame.
+ * @param mode How to combine the layer with the ones below it.
+ * @param amount How much of the layer is shown, out of 256. For BLEND_ALPHA this is
+ *               its opacity, for the rest its brightness.
+ */
+template<class T, Blend mode = BLEND_ALPHA, uint8_t amount = 0xFF> struct Layer {
+
+    typedef typename T::Kernel Kernel;
+
+    /**
+     * The frame rate the layer is meant to run at.
+     */
+    static const uint8_t fps = T::fps;
+
+    /**
+     * Combine a colour of the layer with the colour below it.
+     *
+     * @param below The colour so far, to be updated.
+     * @param above The colour of this layer.
+     */
+    static void apply(CRGB &below, CRGB above) {
+        if((mode != BLEND_ALPHA) && (amount != 0xFF)) {
+            above.nscale8(amount);
+        }
+
+        switch(mode) {
+            case BLEND_ALPHA:
+                nblend(below, above, amount);
+                break;
+            case BLEND_ADD:
+                below += above;
+                break;
+            case BLEND_SCREEN:
+                // 1 - (1 - a) * (1 - b), i.e. a + b * (1 - a).
+                below.r += scale8(above.r, 0xFF - below.r);
+                below.g += scale8(above.g, 0xFF - below.g);
+                below.b += scale8(above.b, 0xFF - below.b);
+                break;
+            case BLEND_MAX:
+                below.r = above.r > below.r ? above.r : below.r;
+                below.g = above.g > below.g ? above.g : below.g;
+                below.b = above.b > below.b ? above.b : below.b;
+                break;
+        }
+    }
+};
+
+/**
+ * Compile time helpers for the compositor.
+ */
+namespace compositor {
+
+    /**
+     * The highest frame rate of a list of layers.
+     */
+    template<class... L> struct Fastest;
+
+    template<> struct Fastest<> {
+        static const uint8_t fps = 1;
+    };
+
+    template<class L, class... R> struct Fastest<L, R...> {
+        static const uint8_t fps = L::fps > Fastest<R...>::fps ? L::fps : Fastest<R...>::fps;
+    };
+
+    /**
+     * The kernels of a list of layers, from the bottom one up.
+     *
+     * @param rate The frame rate of the composed effect.
+     */
+    template<uint8_t rate, class... L> class Stack;
+
+    template<uint8_t rate> class Stack<rate> {
+
+        public:
+
+            void blend(CRGB &colour, Effect::Index n, Effect::Coord i, Effect::Coord j) { }
+
+            void update() { }
+    };
+
+    template<uint8_t rate, class L, class... R> class Stack<rate, L, R...> {
+
+        public:
+
+            /**
+             * Combine the colour of every layer for a pixel.
+             *
+             * @param colour The colour of the layers below, to be updated.
+             * @param n The linear index of the pixel.
+             * @param i The row index.
+             * @param j The column index.
+             */
+            void blend(CRGB &colour, Effect::Index n, Effect::Coord i, Effect::Coord j) {
+                L::apply(colour, kernel.call(n, i, j));
+                rest.blend(colour, n, i, j);
+            }
+
+            /**
+             * Move every layer that is due on to its next frame. Layers slower than the
+             * composed effect skip some frames, so that each keeps its own pace.
+             */
+            void update() {
+                phase += L::fps;
+                if(phase >= rate) {
+                    phase -= rate;
+                    kernel.update();
+                }
+                rest.update();
+            }
+
+        private:
+
+            /**
+             * The layer's kernel, and how far it is from its next frame.
+             */
+            typename L::Kernel kernel;
+            uint16_t phase = 0;
+
+            /**
+             * The layers above.
+             */
+            Stack<rate, R...> rest;
+    };
+}
+
+/**
+ * Effect made of other effects stacked on top of each other. All the layers are
+ * worked out pixel by pixel in a single fill, so there is a single frame buffer no
+ * matter how many layers there are. It runs at the frame rate of the fastest layer.
+ *
+ * @param Layers The layers, from the bottom one up, as Layer<...>.
+ */
+template<class... Layers> class Compositor : public Effect {
+
+    static_assert(sizeof...(Layers) > 0, "The compositor needs at least one layer");
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The frame rate the effect is meant to run at.
+         */
+        static const uint8_t fps = compositor::Fastest<Layers...>::fps;
+
+        /**
+         * Update the contents of the LED matrix.
+         */
+        void update() {
+            fill(&callback);
+            present(fps);
+            if(due()) {
+                callback.update();
+            }
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Effect callback that combines the layers.
+         */
+        class Callback : public LinearFillCallback<Callback> {
+
+            public:
+
+                /**
+                 * Callback function. Stacks the layers, starting from black.
+                 *
+                 * @param n The linear index of the pixel.
+                 * @param i The row index.
+                 * @param j The column index.
+                 *
+                 * @returns An RGB colour to be set at the given position.
+                 */
+                CRGB call(Index n, Coord i, Coord j) {
+                    CRGB colour = CRGB::Black;
+                    layers.blend(colour, n, i, j);
+                    return colour;
+                }
+
+                /**
+                 * Move the layers on to their next frame.
+                 */
+                void update() {
+                    layers.update();
+                }
+
+            private:
+
+                /**
+                 * The layers.
+                 */
+                compositor::Stack<fps, Layers...> layers;
+        };
+
+        /**
+         * The callback instance, kept inline.
+         */
+        Callback callback;
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The per pixel part of the effect, so that composed effects can be layered in
+         * turn.
+         */
+        typedef Callback Kernel;
+};
+
+#endif  // COMPOSITOR_H_
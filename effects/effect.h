@@ -12,8 +12,62 @@
 #include <avr/pgmspace.h>  // Allow access to PROGMEM.
 #include <FastLED.h>       // LED control library.
 
+#include "geometry.h"      // Shape of the matrix.
+#include "output.h"        // Data pins.
+#include "power.h"         // Power limiting.
+#include "palette.h"       // Colour palettes.
+#include "scheduler.h"     // Frame rate control.
 
-typedef TProgmemPalette16 ColourPalette;
+
+#ifndef EFFECT_TELEMETRY
+/**
+ * How many frames each telemetry record sent over serial covers (see telemetry.h).
+ * Set it to 0, the default, to leave telemetry out altogether.
+ */
+#define EFFECT_TELEMETRY 0
+#endif
+
+#if EFFECT_TELEMETRY > 0
+#ifdef EFFECT_PROBE
+#error "Telemetry uses EFFECT_PROBE, and can't be combined with other probes"
+#endif
+#include "telemetry.h"  // Frame timing telemetry.
+#define EFFECT_PROBE(phase) Telemetry::enter(phase)
+#endif
+
+#ifndef EFFECT_PROBE
+/**
+ * Hook called whenever a frame moves to a new phase (see Effect::Phase). It does
+ * nothing unless defined before including this file, which is how the benchmarks
+ * measure each phase.
+ */
+#define EFFECT_PROBE(phase)
+#endif
+
+#ifndef EFFECT_GEOMETRY
+/**
+ * The shape and wiring of the LED matrix, as a Geometry<...>. Building for another
+ * lamp is a matter of defining this.
+ */
+#define EFFECT_GEOMETRY LampGeometry
+#endif
+
+#ifndef EFFECT_BRIGHTNESS
+/**
+ * Brightness of the LEDs, out of 255. It is lowered further whenever a frame would
+ * draw too much power (see Power).
+ */
+#define EFFECT_BRIGHTNESS 0x18
+#endif
+
+#ifndef EFFECT_REFRESH
+/**
+ * Frame rate at which keyframed effects are shown (see Effect::interpolate()). Set it
+ * to 0 to show only the keyframes. Every frame that changes sends the whole matrix,
+ * with interrupts off, so it is best kept low.
+ */
+#define EFFECT_REFRESH 30
+#endif
 
 /**
  * Abstract class for effects to be shown on the circular cylindrical LED
@@ -21,33 +75,104 @@ typedef TProgmemPalette16 ColourPalette;
  */
 class Effect {
 
+    friend class Transition;  // Drives effects without them showing their frames.
+
     public:  ///////////////////////////////////////////////////////////////////////
 
+        /**
+         * How the matrix is split across data pins (see EFFECT_PINS).
+         */
+        typedef Layout<EFFECT_GEOMETRY, EFFECT_PINS> Output;
+
+        /**
+         * The shape and wiring of the matrix (see EFFECT_GEOMETRY), with serpentine
+         * strips starting over on every data pin.
+         */
+        typedef Output::Wired Shape;
+
+        /**
+         * Types for coordinates, and for positions in the frame buffer. Both grow with
+         * the size of the matrix.
+         */
+        typedef Shape::Coord Coord;
+        typedef Shape::Index Index;
+
         /**
          * Define the shape of the matrix. Rows defines the height and cols the diameter.
          */
-        static const uint8_t rows = 16, cols = 14;
+        static const Coord rows = Shape::rows, cols = Shape::cols;
 
         /**
          * The total amount of LEDs in the matrix.
          */
-        static const uint16_t num_leds = rows * cols;
+        static const Index num_leds = Shape::num_leds;
+
+        /**
+         * The running estimate of the power drawn by the LEDs (see EFFECT_MAX_POWER).
+         */
+        typedef PowerMeter<Shape> Power;
+
+        /**
+         * The phases a frame goes through, as reported to EFFECT_PROBE.
+         */
+        enum Phase : uint8_t {
+            PHASE_EFFECT = 1,  // Effect specific work (e.g. a callback's update).
+            PHASE_FILL   = 2,  // Filling the frame buffer.
+            PHASE_SHOW   = 3,  // Sending the frame buffer to the LEDs.
+            PHASE_WAIT   = 4,  // Waiting to keep the frame rate.
+        };
+
+#if EFFECT_TELEMETRY > 0
+        static_assert(PHASE_WAIT == Telemetry::phases, "Telemetry must measure every phase");
+#endif
+
+        /**
+         * Destructor. Allows effects to be deleted through a pointer to this class.
+         */
+        virtual ~Effect() {
+            if(owner == this) {
+                owner = nullptr;  // Another effect may be built at the same address.
+            }
+        }
 
         /**
          * Abstract method. This updates the contents of the LED matrix.
          */
         virtual void update() = 0;
 
+        /**
+         * Get the frame rate that is actually being achieved.
+         *
+         * @returns The frames per second, measured over the last second.
+         */
+        float achieved_fps() const {
+            return scheduler.achieved_fps();
+        }
+
+        /**
+         * Get the amount of frames that were ready too late to keep the frame rate.
+         *
+         * @returns The overrun counter. Wraps around on overflow.
+         */
+        uint16_t overruns() const {
+            return scheduler.overruns();
+        }
+
     protected:  ////////////////////////////////////////////////////////////////////
 
         /**
-         * Constructor. Initialises the LED matrix through the FastLED library.
+         * Constructor. Initialises the LED matrix through the FastLED library. The frame
+         * buffer is shared by all effects, so this is only done by the first one.
          */
         Effect() {
-            FastLED.addLeds<WS2812, 13, GRB>(this -> buffer, num_leds).setCorrection(TypicalLEDStrip);
+            if(FastLED.count() == 0) {
+                Output::attach(buffer);
 
-            FastLED.setMaxPowerInVoltsAndMilliamps(5, 2000);  // Max 5V, 2A.
-            FastLED.setBrightness(0x18);
+                // Power is limited on every transmit(), see Power.
+                FastLED.setBrightness(EFFECT_BRIGHTNESS);
+            }
+
+            invalidate();
         }
 
         /**
@@ -61,7 +186,7 @@ class Effect {
          * @warning This will not validate the inputs, and using invalid coordinates
          *          results in undefined behaviour.
          */
-        CRGB get_led(uint8_t i, uint8_t j) {
+        CRGB get_led(Coord i, Coord j) {
             return buffer[index(i, j)];
         }
 
@@ -75,8 +200,18 @@ class Effect {
          * @warning This will not validate the inputs, and using invalid coordinates
          *          results in undefined behaviour.
          */
-        void set_led(uint8_t i, uint8_t j, CRGB colour) {
-            buffer[index(i, j)] = colour;
+        void set_led(Coord i, Coord j, CRGB colour) {
+            CRGB &led = buffer[index(i, j)];
+            if(mix != 0) {
+                const CRGB old = led;
+                nblend(led, colour, mix);
+                Power::replace(old, led);
+                mark(j);
+            } else if(led != colour) {
+                Power::replace(led, colour);
+                led = colour;
+                mark(j);
+            }
         }
 
         /**
@@ -89,8 +224,8 @@ class Effect {
          * @warning This will not validate the inputs, and using invalid coordinates
          *          results in undefined behaviour.
          */
-        void set_led(uint8_t i, uint8_t j, uint16_t colour) {
-            buffer[index(i, j)] = colour;
+        void set_led(Coord i, Coord j, uint16_t colour) {
+            set_led(i, j, CRGB(colour));
         }
 
         /**
@@ -100,6 +235,11 @@ class Effect {
 
             public:
 
+                /**
+                 * Destructor. Allows callbacks to be deleted through a pointer to this class.
+                 */
+                virtual ~FillCallback() { }
+
                 /**
                  * Callback function.
                  *
@@ -108,7 +248,71 @@ class Effect {
                  *
                  * @returns An RGB colour to be set at the given coordinates.
                  */
-                virtual CRGB call(uint8_t i, uint8_t j) = 0;
+                virtual CRGB call(Coord i, Coord j) = 0;
+        };
+
+        /**
+         * Callback interface for the fill method, resolved at compile time.
+         *
+         * Subclasses pass themselves as the template parameter and implement
+         * `CRGB call(Index n, Coord i, Coord j)`, where n is the linear position of the
+         * LED in the frame buffer (`index(i, j)`) and i and j its row and column.
+         * Since the call is not virtual it can be inlined into the fill loop, and since
+         * the buffer is walked in storage order the callback can index its own arrays
+         * directly. The coordinates come for free, so they need not be derived from n.
+         */
+        template<class T> class LinearFillCallback { };
+
+        /**
+         * Linear fill callback for effects that only vary in brightness. The effect keeps
+         * an intensity per LED, in storage order, and every LED is shown as the tint
+         * colour scaled by its intensity.
+         *
+         * Scaling uses scale8(), one 8 bit multiply per channel, and since the tint is
+         * known at compile time channels at 0 or 0xFF skip even that.
+         *
+         * @param T The subclass, as with LinearFillCallback.
+         * @param tint The colour for a full intensity, as 0xRRGGBB.
+         */
+        template<class T, uint32_t tint> class TintFillCallback : public LinearFillCallback<T> {
+
+            public:
+
+                /**
+                 * Callback function.
+                 *
+                 * @param n The linear index of the LED.
+                 * @param i The row index.
+                 * @param j The column index.
+                 *
+                 * @returns The tint, scaled by the intensity of the LED.
+                 */
+                CRGB call(Index n, Coord i, Coord j) {
+                    const uint8_t level = intensity[n];
+                    return CRGB(channel(level, (tint >> 16) & 0xFF),
+                                channel(level, (tint >> 8) & 0xFF),
+                                channel(level, tint & 0xFF));
+                }
+
+            protected:
+
+                /**
+                 * The intensity of each LED, in storage order (see index()).
+                 */
+                uint8_t intensity[num_leds] = { };
+
+            private:
+
+                /**
+                 * Scale a channel of the tint. Same as scale8(), which leaves a level
+                 * untouched when scaling by 0xFF.
+                 *
+                 * @param level The intensity of the LED.
+                 * @param scale The channel of the tint.
+                 */
+                static uint8_t channel(uint8_t level, uint8_t scale) {
+                    return scale == 0xFF ? level : (scale == 0 ? 0 : scale8(level, scale));
+                }
         };
 
         /**
@@ -119,36 +323,284 @@ class Effect {
          *                 the colour to be set.
          */
         void fill(FillCallback *callback) {
-            for(uint8_t i = 0; i < rows; ++i) {
-                for(uint8_t j = 0; j < cols; ++j) {
+            EFFECT_PROBE(PHASE_FILL);
+            for(Coord i = 0; i < rows; ++i) {
+                for(Coord j = 0; j < cols; ++j) {
                     set_led(i, j, callback -> call(i, j));
                 }
             }
+            EFFECT_PROBE(PHASE_EFFECT);
+        }
+
+        /**
+         * Helper method that iterates over the LEDs frame buffer in storage order and
+         * changes its content.
+         *
+         * @param callback A function that receives the linear index and coordinates of
+         *                 an LED and returns the colour to be set.
+         */
+        template<class T> void fill(LinearFillCallback<T> *callback) {
+            EFFECT_PROBE(PHASE_FILL);
+            T *kernel = static_cast<T *>(callback);
+            Index n = 0;
+            if(mix != 0) {
+                bool changed = false;
+                for(Coord line = 0; line < Shape::lines; ++line) {
+                    for(Coord k = 0; k < Shape::length; ++k, ++n) {
+                        const Coord i = Shape::line_row(line, k), j = Shape::line_col(line, k);
+                        const CRGB old = buffer[n];
+                        nblend(buffer[n], kernel -> call(n, i, j), mix);
+                        if(buffer[n] != old) {
+                            Power::replace(old, buffer[n]);
+                            changed = true;
+                        }
+                    }
+                }
+                if(changed) {
+                    blended();
+                }
+                EFFECT_PROBE(PHASE_EFFECT);
+                return;
+            }
+
+            for(Coord line = 0; line < Shape::lines; ++line) {
+                bool changed = false;
+                for(Coord k = 0; k < Shape::length; ++k, ++n) {
+                    const Coord i = Shape::line_row(line, k), j = Shape::line_col(line, k);
+                    const CRGB colour = kernel -> call(n, i, j);
+                    if(buffer[n] != colour) {
+                        Power::replace(buffer[n], colour);
+                        buffer[n] = colour;
+                        changed = true;
+                        if(!Shape::column_major) {
+                            mark(j);  // Every LED in the line is in a different column.
+                        }
+                    }
+                }
+                if(changed && Shape::column_major) {
+                    mark(line);
+                }
+            }
+            EFFECT_PROBE(PHASE_EFFECT);
         }
 
         /**
-         * Helper method that fills all of the frame buffer with a single colour.
+         * Helper method that fills all of the frame buffer with a single colour. Effects
+         * showing a uniform colour should use this: it is a single block write, and it
+         * is skipped altogether if the buffer already holds that colour.
          *
          * @param colour The colour to be used.
          */
         void fill(CRGB colour) {
-            for(uint8_t i = 0; i < rows; ++i) {
-                for(uint8_t j = 0; j < cols; ++j) {
-                    set_led(i, j, colour);
+            EFFECT_PROBE(PHASE_FILL);
+            if(mix != 0) {
+                bool changed = false;
+                for(Index n = 0; n < num_leds; ++n) {
+                    const CRGB old = buffer[n];
+                    nblend(buffer[n], colour, mix);
+                    if(buffer[n] != old) {
+                        Power::replace(old, buffer[n]);
+                        changed = true;
+                    }
+                }
+                if(changed) {
+                    blended();
+                }
+            } else if(!uniform || (buffer[0] != colour)) {
+                fill_solid(buffer, num_leds, colour);
+                Power::reset(colour);
+                memset(dirty, 0xFF, sizeof(dirty));
+                uniform = true;
+            }
+            EFFECT_PROBE(PHASE_EFFECT);
+        }
+
+        /**
+         * Check whether the frame buffer still holds the last frame this effect showed.
+         * If so, effects may only write the LEDs that changed since. That is not the case
+         * on an effect's first frame, nor while it is being blended with another one.
+         */
+        bool owns() const {
+            return (owner == this) && !held;
+        }
+
+        /**
+         * Check whether the effect is to move on to its next frame once this one is
+         * filled in. It always is, unless a transition running at a higher frame rate
+         * than the effect needs the same frame again, or the frame is one of those
+         * faded in before a keyframe (see interpolate()).
+         */
+        bool due() const {
+            return !paused && (tweens == 0);
+        }
+
+        /**
+         * Get the frame buffer, for effects that decode their frames rather than compute
+         * them. It is in storage order (see index()), so frames sent in the same order
+         * can be written LED after LED with no mapping. Colours are written as they are,
+         * with no blending, and changed() has to be called for whatever was written.
+         */
+        static CRGB *pixels() {
+            return buffer;
+        }
+
+        /**
+         * Flag some LEDs as changed after writing to them through pixels().
+         *
+         * @param first The position of the first LED written, in storage order.
+         * @param count The amount of consecutive LEDs written.
+         */
+        static void changed(Index first, Index count) {
+            if(count == 0) {
+                return;
+            }
+            Power::invalidate();  // What was there before is gone.
+            if(Shape::column_major) {
+                const Coord last = (first + count - 1) / rows;
+                for(Coord j = first / rows; j <= last; ++j) {
+                    mark(j);
                 }
+            } else {
+                blended();  // Every row spans all the columns.
             }
         }
 
+        /**
+         * Force the whole frame buffer to be sent on the next show, e.g. after changing
+         * the brightness.
+         */
+        static void invalidate() {
+            memset(dirty, 0xFF, sizeof(dirty));
+        }
+
         /**
          * Take the current contents on the frame buffer and display it on the real LED
          * matrix.
          *
          * @param fps This defines the frequency at which the display will be updated by
-         *            halting execution momentarily.
+         *            halting execution until the next frame is due. The time spent
+         *            computing and showing the frame counts towards it.
          */
         void show(uint8_t fps) {
-            FastLED.show();
-            FastLED.delay(1000 / fps);
+            if(held) {
+                return;
+            }
+
+            EFFECT_PROBE(PHASE_SHOW);
+            transmit(scheduler);
+            owner = this;
+            EFFECT_PROBE(PHASE_WAIT);
+            scheduler.wait(fps);
+            EFFECT_PROBE(PHASE_EFFECT);
+        }
+
+        /**
+         * Pipelined version of show(). Wait until the frame in the buffer is due, display
+         * it and return straight away, so the next frame is computed during what would
+         * otherwise be idle time and shown exactly on its deadline.
+         *
+         * There is no need for a second frame buffer, since FastLED is done with the
+         * buffer by the time it returns.
+         *
+         * @param fps This defines the frequency at which the display will be updated.
+         */
+        void present(uint8_t fps) {
+            if(held) {
+                return;
+            }
+
+            EFFECT_PROBE(PHASE_WAIT);
+            scheduler.sleep();
+            EFFECT_PROBE(PHASE_SHOW);
+            transmit(scheduler);
+            owner = this;
+            scheduler.next(fps);
+            EFFECT_PROBE(PHASE_EFFECT);
+        }
+
+        /**
+         * Keyframed version of present(). The callback gives the next keyframe, to be
+         * shown at the given frame rate, and the frames in between are faded linearly
+         * from the last keyframe towards it, at up to EFFECT_REFRESH frames per second.
+         * The effect's own update only has to run at the keyframe rate.
+         *
+         * No second frame buffer is needed: with k frames left to the keyframe, blending
+         * 1/k of the keyframe into what is being shown lands on the same colours as a
+         * lerp between both keyframes would. The callback is called again for every
+         * frame, so its output may not change between keyframes. Frames in which the
+         * blend changed no colour at all are not sent.
+         *
+         * Every call shows a single frame and returns, so the loop keeps running in
+         * between (e.g. to read the button), and due() only says so once the keyframe
+         * itself was shown.
+         *
+         * @param callback A function that receives the linear index and coordinates of
+         *                 an LED and returns the colour for the next keyframe.
+         * @param fps The keyframe rate.
+         */
+        template<class T> void interpolate(LinearFillCallback<T> *callback, uint8_t fps) {
+            if(held || (fps >= refresh)) {
+                tweens = 0;
+                fill(callback);
+                present(fps);
+                return;
+            }
+
+            const uint8_t frames = refresh / fps;
+            tweens = (tweens == 0 ? frames : tweens) - 1;
+            mix = tween(tweens + 1);
+            fill(callback);
+            mix = 0;
+            present(fps * frames);
+        }
+
+        /**
+         * Keyframed version of present(), for effects showing a uniform colour (see
+         * fill(CRGB)).
+         *
+         * @param colour The colour for the next keyframe.
+         * @param fps The keyframe rate.
+         */
+        void interpolate(CRGB colour, uint8_t fps) {
+            if(held || (fps >= refresh)) {
+                tweens = 0;
+                fill(colour);
+                present(fps);
+                return;
+            }
+
+            const uint8_t frames = refresh / fps;
+            tweens = (tweens == 0 ? frames : tweens) - 1;
+            mix = tween(tweens + 1);
+            fill(colour);
+            mix = 0;
+            present(fps * frames);
+        }
+
+        /**
+         * Compute the linear coordinate of an LED in the buffer based on its real
+         * position. Effects may use the same to lay out their own per LED arrays in
+         * storage order.
+         *
+         * @param i The row coordinate of the LED.
+         * @param j The column coordinate of the LED.
+         *
+         * @warning This will not validate the inputs, and using invalid coordinates
+         *          results in undefined behaviour.
+         */
+        static constexpr Index index(Coord i, Coord j) {
+            return Shape::index(i, j);
+        }
+
+        /**
+         * Get a random coordinate, using 8 bit maths whenever coordinates fit in a byte.
+         *
+         * @param limit The amount of rows or columns.
+         *
+         * @returns A coordinate between 0 and limit - 1.
+         */
+        static Coord random_coord(Coord limit) {
+            return sizeof(Coord) == 1 ? random8(limit) : random16(limit);
         }
 
         /**
@@ -161,26 +613,150 @@ class Effect {
             return ColorFromPalette(palette, index, 0xFF, LINEARBLEND);
         }
 
+        /**
+         * Keeps the frame rate steady. Effects may change its overrun policy.
+         */
+        Scheduler scheduler;
+
     private:  //////////////////////////////////////////////////////////////////////
 
+        /**
+         * Frames left to fade in before the next keyframe is reached, besides the one
+         * being shown (see interpolate()).
+         */
+        uint8_t tweens = 0;
+
         /**
          * The frame buffer which will hold the information to be shown on next update.
+         * There is a single one for the single LED matrix, shared by all effects.
          */
-        CRGB buffer[num_leds] = { };  // Initialise the buffer with black.
+        static CRGB buffer[num_leds];
 
         /**
-         * Compute the linear coordinate of an LED in the buffer based on its real
-         * position.
+         * One bit per column, set if any LED in it changed since the last show. Starts
+         * all set, since the state of the real LEDs is unknown.
+         */
+        static uint8_t dirty[(cols + 7) / 8];
+
+        /**
+         * Whether the whole frame buffer is known to hold a single colour.
+         */
+        static bool uniform;
+
+        /**
+         * How much of each colour written to the frame buffer is blended into what was
+         * already there, out of 256. While 0, colours simply replace the old ones. Set
+         * by transitions.
+         */
+        static uint8_t mix;
+
+        /**
+         * Whether frames are held back instead of being shown. While set, show() and
+         * present() return straight away. Set by transitions.
+         */
+        static bool held;
+
+        /**
+         * Whether effects are to fill in the same frame again rather than move on (see
+         * due()). Set by transitions.
+         */
+        static bool paused;
+
+        /**
+         * The effect that showed the last frame, or null.
+         */
+        static const Effect *owner;
+
+        /**
+         * Frame rate at which keyframed effects are shown (see EFFECT_REFRESH). Being
+         * a constant rather than the macro, comparing against a 0 doesn't warn.
+         */
+        static const uint8_t refresh = EFFECT_REFRESH;
+
+        /**
+         * Flag a column as changed.
          *
-         * @param i The row coordinate of the LED.
-         * @param j The column coordinate of the LED.
+         * @param j The column index.
+         */
+        static void mark(Coord j) {
+            dirty[j >> 3] |= 1 << (j & 0x07);
+            uniform = false;
+        }
+
+        /**
+         * How much of a keyframe to blend in, out of 256, with some frames left to it.
          *
-         * @warning This will not validate the inputs, and using invalid coordinates
-         *          results in undefined behaviour.
+         * @param left The amount of frames left until the keyframe, this one included.
+         */
+        static uint8_t tween(uint8_t left) {
+            return left == 1 ? 0xFF : 0x100 / left;
+        }
+
+        /**
+         * Flag the whole frame buffer as changed after blending colours into it.
+         */
+        static void blended() {
+            invalidate();
+            uniform = false;
+        }
+
+        /**
+         * Send the frame buffer to the LEDs. Only the segments (see Output) with changed
+         * columns are sent, since the others keep showing the same; if none changed
+         * nothing is sent at all.
+         *
+         * The brightness is lowered if the frame would draw too much power (see Power).
+         * Since that changes every LED, all segments are sent then.
+         *
+         * @param scheduler The scheduler keeping the frame rate, to make up for the time
+         *                  lost while sending.
          */
-        static uint16_t index(uint8_t i, uint8_t j) {
-            return ((uint16_t) i) + ((uint16_t) j) * ((uint16_t) rows);
+        static void transmit(Scheduler &scheduler) {
+            const uint8_t level = Power::limit(buffer, EFFECT_BRIGHTNESS);
+#if EFFECT_TELEMETRY > 0
+            Telemetry::frame(scheduler.overruns(), Power::requested(), Power::throttled());
+#endif
+            if(level != FastLED.getBrightness()) {
+                FastLED.setBrightness(level);
+                invalidate();
+            }
+
+            uint32_t expected = 0;
+            for(uint8_t k = 0; k < Output::segments; ++k) {
+                const Coord first = Output::first(k), last = first + Output::width(k);
+                bool changed = false;
+                for(Coord j = first; j < last; ++j) {
+                    changed |= (dirty[j >> 3] >> (j & 0x07)) & 1;
+                }
+
+                // Strips without LEDs send nothing.
+                FastLED[k].setLeds(buffer + index(0, first), changed ? Output::length(k) : 0);
+                if(changed) {
+                    const uint32_t taken = Output::time(Output::length(k));
+                    expected = EFFECT_PARALLEL_OUTPUT ? (taken > expected ? taken : expected) :
+                                                       expected + taken;
+                }
+            }
+            if(expected == 0) {
+                return;
+            }
+
+            const uint32_t start = scheduler.now();
+            FastLED.show();
+            scheduler.compensate(start, expected);
+            memset(dirty, 0, sizeof(dirty));
         }
+
 };
 
+// Allocate the state shared by all effects. Being static, the frame buffer starts
+// black.
+CRGB Effect::buffer[Effect::num_leds];
+uint8_t Effect::dirty[(Effect::cols + 7) / 8];
+bool Effect::uniform = false;
+uint8_t Effect::mix = 0;
+bool Effect::held = false;
+bool Effect::paused = false;
+const Effect *Effect::owner = nullptr;
+
 #endif  // EFFECT_H_
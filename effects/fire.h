@@ -20,19 +20,19 @@ class Fire : public Effect {
     public:  ///////////////////////////////////////////////////////////////////////
 
         /**
-         * Destructor. Free up resources.
+         * The frame rate the effect is meant to run at.
          */
-        ~Fire() {
-            delete callback;
-        }
+        static const uint8_t fps = 30;
 
         /**
          * Update the contents of the LED matrix.
          */
         void update() {
-            fill(callback);
-            show(30);  // Show changes and keep the code to ~30 FPS.
-            callback -> update();
+            fill(&callback);
+            present(fps);  // Show changes and keep the code to ~30 FPS.
+            if(due()) {
+                callback.update();
+            }
         }
 
     private:  //////////////////////////////////////////////////////////////////////
@@ -40,103 +40,162 @@ class Fire : public Effect {
         /**
          * The fire-ish colour palette.
          */
-        static const ColourPalette palette PROGMEM;
+        struct Palette {
+            static constexpr uint32_t colours[16] = {
+                0xFFD033, 0xFFBE33, 0xFEAE01, 0xFE9A01,
+                0xFE8F01, 0xFA7D01, 0xEF7101, 0xD86001,
+                0xAF4A01, 0x923701, 0x651802, 0x470202,
+                0x2E0001, 0x140101, 0x070101, 0x050000,
+            };
+        };
 
         /**
-         * Get a colour from the palette.
+         * Get a colour from the palette. All 256 colours are precomputed in flash.
          */
         static CRGB get_colour(uint8_t index) {
-            return interpolate_colour(palette, index);
+            return PaletteTable<Palette>::get(index);
         }
 
         /**
          * Effect callback that will compute and show the fire.
+         *
+         * The fire is simulated as a grid of heat, in the spirit of FastLED's Fire2012:
+         * every frame all cells cool down a bit, heat drifts up while spreading to the
+         * sides (across the seam too, the lamp being a cylinder), and new sparks are lit
+         * at the bottom.
          */
-        class Callback : public FillCallback {
+        class Callback : public LinearFillCallback<Callback> {
 
             public:
 
+                /**
+                 * Constructor. Starts with a cold, dark fire.
+                 */
+                Callback() {
+                    memset(heat, 0, sizeof(heat));
+                }
+
                 /**
                  * Callback function. Shows the fire animation.
                  *
+                 * @param n The linear index of the pixel.
                  * @param i The row index.
                  * @param j The column index.
                  *
-                 * @returns An RGB colour to be set at the given coordinates.
+                 * @returns An RGB colour to be set at the given position.
                  */
-                CRGB call(uint8_t i, uint8_t j) {
-                    return get_colour(fire[index(i, j)]);
+                CRGB call(Index n, Coord i, Coord j) {
+                    // The palette goes from hot to cold.
+                    return get_colour(ceiling - scale8(heat[n], ceiling));
                 }
 
                 /**
                  * Create the next frame of the fire-like animation.
                  */
                 void update() {
-                    // Shift all rows up and "decay" the colours.
-                    for(uint8_t i = rows - 1; i > 0;--i) {
-                        for(uint8_t j = 0; j < cols; ++j) {
-                            fire[index(i, j)] = qadd8(fire[index(i - 1, j)], 0x1F) - 0x0F;
-                        }
-                    }
-
-                    // Create a new random bottom row.
-                    for(uint8_t j = 0; j < cols; ++j) {
-                        fire[index(0, j)] = random8(0x20, 0x90);
-                    }
+                    cool();
+                    rise();
+                    spark();
                 }
 
             private:
 
                 /**
-                 * An array with the info to be shown. Contents are indices to be used with the
-                 * colour palette.
+                 * The last palette index used, as the ones after it blend back into the
+                 * first colour.
+                 */
+                static const uint8_t ceiling = 0xF0;
+
+                /**
+                 * How much a cell may cool down each frame. Taller lamps cool slower, so
+                 * flames reach about as high up the lamp. Lamps of only a row or two would
+                 * go over what random8() takes, so they cool as fast as it goes.
+                 */
+                static const uint16_t full_cooling = 550 / rows + 2;
+                static const uint8_t cooling = full_cooling > 0xFF ? 0xFF : full_cooling;
+
+                /**
+                 * Chance out of 256 of a column getting a spark each frame.
+                 */
+                static const uint8_t sparking = 120;
+
+                /**
+                 * How many rows at the bottom sparks may show up in.
+                 */
+                static const Coord spark_rows = rows / 8 + 1;
+
+                /**
+                 * The heat of each cell, in storage order (see index()), so that filling
+                 * the frame buffer reads it straight through.
+                 */
+                uint8_t heat[num_leds];
+
+                /**
+                 * Cool every cell down by a random amount.
                  */
-                uint8_t fire[num_leds] = {  // Initialise to a dark background.
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-                 };
+                void cool() {
+                    for(Index n = 0; n < num_leds; ++n) {
+                        heat[n] = qsub8(heat[n], random8(cooling));
+                    }
+                }
 
                 /**
-                 * Compute the linear coordinate of a pixel in the array based on its real
-                 * position.
+                 * Move the heat up a row, spreading it to the sides. Each cell (the `#`)
+                 * becomes a weighted average of the 3 cells below it and the one 2 rows
+                 * below, with weights out of 8:
                  *
-                 * @param i The row coordinate of the pixel.
-                 * @param j The column coordinate of the pixel.
+                 *     . # .
+                 *     1 4 1
+                 *     . 2 .
                  *
-                 * @warning This will not validate the inputs, and using invalid coordinates
-                 *          results in undefined behaviour.
+                 * The second row, having a single row below it, takes the bottom row for
+                 * both. Only lower rows are read, so going from the top row down every row
+                 * can be overwritten as soon as it's done with, and there is no need for a
+                 * second grid. The bottom row stays put.
+                 */
+                void rise() {
+                    for(Coord i = rows - 1; i > 0; --i) {
+                        const Coord below = i - 1, below2 = i > 1 ? i - 2 : 0;
+
+                        // Slide a window over the row below, wrapping around the seam.
+                        uint8_t left = heat[index(below, Shape::left(0))];
+                        uint8_t centre = heat[index(below, 0)];
+                        for(Coord j = 0; j < cols; ++j) {
+                            const uint8_t right = heat[index(below, Shape::right(j))];
+                            heat[index(i, j)] = (left + 4 * (uint16_t) centre + right +
+                                                 2 * (uint16_t) heat[index(below2, j)]) >> 3;
+                            left = centre;
+                            centre = right;
+                        }
+                    }
+                }
+
+                /**
+                 * Randomly light new sparks near the bottom.
                  */
-                static uint16_t index(uint8_t i, uint8_t j) {
-                    return ((uint16_t) i) + ((uint16_t) j) * ((uint16_t) rows);
+                void spark() {
+                    for(Coord j = 0; j < cols; ++j) {
+                        if(random8() < sparking) {
+                            uint8_t &cell = heat[index(random_coord(spark_rows), j)];
+                            cell = qadd8(cell, random8(160, 255));
+                        }
+                    }
                 }
         };
 
         /**
-         * The callback instance to be sent to the parent class.
+         * The callback instance to be sent to the parent class. Kept inline, so that
+         * effects never touch the heap.
          */
-        Callback * const callback = new Callback();
-};
+        Callback callback;
+
+    public:  ///////////////////////////////////////////////////////////////////////
 
-// Populate the contents of the colour palette.
-const ColourPalette Fire::palette PROGMEM = {
-    0xFFD033, 0xFFBE33, 0xFEAE01, 0xFE9A01,
-    0xFE8F01, 0xFA7D01, 0xEF7101, 0xD86001,
-    0xAF4A01, 0x923701, 0x651802, 0x470202,
-    0x2E0001, 0x140101, 0x070101, 0x050000,
+        /**
+         * The per pixel part of the effect, so that it can be layered with others (see
+         * compositor.h).
+         */
+        typedef Callback Kernel;
 };
 
 #endif  // FIRE_H_
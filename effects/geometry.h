@@ -0,0 +1,167 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Shape and wiring of the LED matrix.                                          *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GEOMETRY_H_
+#define GEOMETRY_H_
+
+#include <stdint.h>  // Fixed width integer types.
+
+
+/**
+ * Which way the LED strip runs through the matrix.
+ */
+enum Order : uint8_t {
+    COLUMN_MAJOR,  // Column by column, each one from the bottom up.
+    ROW_MAJOR,     // Row by row, each one from the first column on.
+};
+
+/**
+ * Compile time helpers for geometries.
+ */
+namespace geometry {
+
+    /**
+     * Pick one of two types.
+     */
+    template<bool first, class A, class B> struct Pick {
+        typedef A type;
+    };
+
+    template<class A, class B> struct Pick<false, A, B> {
+        typedef B type;
+    };
+
+    /**
+     * The smallest unsigned type with at least the given amount of bits.
+     */
+    template<uint16_t bits> struct Mask {
+        static_assert(bits <= 32, "Masks of more than 32 bits are not supported");
+        typedef typename Pick<(bits <= 8), uint8_t,
+                typename Pick<(bits <= 16), uint16_t, uint32_t>::type>::type type;
+    };
+}
+
+/**
+ * Shape and wiring of an LED matrix, all of it known at compile time.
+ *
+ * LEDs are addressed by row i (0 at the bottom) and column j, and are stored in the
+ * frame buffer in the order they are wired in, so the buffer can be sent as is. The
+ * mapping is constexpr, so it folds away whenever coordinates are constant, and
+ * walking the buffer in storage order (see line_row() and line_col()) needs no
+ * mapping at all.
+ *
+ * @param R The amount of rows, i.e. the height.
+ * @param C The amount of columns, i.e. the width (or the circumference).
+ * @param order Which way the strip runs.
+ * @param serpentine Whether every other line of the strip runs backwards, as happens
+ *                   when a single strip zigzags through the matrix. With several
+ *                   data pins every strip starts over (see Layout::Wired).
+ * @param wrap Whether the first and last columns are next to each other, as they are
+ *             on a cylinder.
+ */
+template<uint16_t R, uint16_t C, Order order = COLUMN_MAJOR, bool serpentine = false, bool wrap = true>
+struct Geometry {
+
+    static_assert((R > 0) && (C > 0), "The matrix can't be empty");
+
+    /**
+     * Type for coordinates, and for positions in the frame buffer.
+     */
+    typedef typename geometry::Pick<(R <= 0xFF) && (C <= 0xFF), uint8_t, uint16_t>::type Coord;
+    typedef typename geometry::Pick<((uint32_t) R) * C <= 0xFFFF, uint16_t, uint32_t>::type Index;
+
+    /**
+     * The size of the matrix.
+     */
+    static const Coord rows = R, cols = C;
+    static const Index num_leds = ((Index) R) * C;
+
+    /**
+     * Whether the strip runs column by column.
+     */
+    static const bool column_major = order == COLUMN_MAJOR;
+
+    /**
+     * Whether the first and last columns are neighbours.
+     */
+    static const bool cylinder = wrap;
+
+    /**
+     * Whether every other line of the strip runs backwards.
+     */
+    static const bool zigzag = serpentine;
+
+    /**
+     * The lines the strip runs through, and their length.
+     */
+    static const Coord lines = column_major ? C : R;
+    static const Coord length = column_major ? R : C;
+
+    /**
+     * Get the position of an LED in the frame buffer.
+     *
+     * @param i The row coordinate of the LED.
+     * @param j The column coordinate of the LED.
+     *
+     * @warning This will not validate the inputs, and using invalid coordinates
+     *          results in undefined behaviour.
+     */
+    static constexpr Index index(Coord i, Coord j) {
+        return column_major ?
+               ((Index) j) * R + ((serpentine && (j & 1)) ? R - 1 - i : i) :
+               ((Index) i) * C + ((serpentine && (i & 1)) ? C - 1 - j : j);
+    }
+
+    /**
+     * Get the row of the k-th LED in a line of the strip.
+     *
+     * @param line The line index.
+     * @param k The position of the LED in the line.
+     */
+    static constexpr Coord line_row(Coord line, Coord k) {
+        return column_major ? ((serpentine && (line & 1)) ? R - 1 - k : k) : line;
+    }
+
+    /**
+     * Get the column of the k-th LED in a line of the strip.
+     *
+     * @param line The line index.
+     * @param k The position of the LED in the line.
+     */
+    static constexpr Coord line_col(Coord line, Coord k) {
+        return column_major ? line : ((serpentine && (line & 1)) ? C - 1 - k : k);
+    }
+
+    /**
+     * Get the column to the left of another one, wrapping around the seam of a
+     * cylinder. On a flat matrix the first column is its own neighbour.
+     *
+     * @param j The column index.
+     */
+    static constexpr Coord left(Coord j) {
+        return j > 0 ? j - 1 : (wrap ? C - 1 : 0);
+    }
+
+    /**
+     * Get the column to the right of another one, wrapping around the seam of a
+     * cylinder. On a flat matrix the last column is its own neighbour.
+     *
+     * @param j The column index.
+     */
+    static constexpr Coord right(Coord j) {
+        return j + 1 < C ? j + 1 : (wrap ? 0 : C - 1);
+    }
+};
+
+/**
+ * The lamp this code was written for: 14 columns of 16 LEDs around a jar, wired
+ * column by column from the bottom up.
+ */
+typedef Geometry<16, 14, COLUMN_MAJOR, false, true> LampGeometry;
+
+#endif  // GEOMETRY_H_
@@ -13,26 +13,30 @@
 
 
 /**
- * Matrix effect implementation.
+ * Matrix effect implementation. The dots of each column are kept as the bits of a
+ * single integer, so it works for matrices of up to 32 rows.
  */
 class Matrix : public Effect {
 
+    static_assert(rows <= 32, "The matrix effect keeps each column in a 32 bit mask, so it "
+                              "can't run on a matrix of more than 32 rows. Leave it out of "
+                              "the Runtime in lamp.ino for taller lamps");
+
     public:  ///////////////////////////////////////////////////////////////////////
 
         /**
-         * Destructor. Free up resources.
+         * The frame rate the effect is meant to run at.
          */
-        ~Matrix() {
-            delete callback;
-        }
+        static const uint8_t fps = 10;
 
         /**
          * Update the contents of the LED matrix.
          */
         void update() {
-            fill(callback);
-            show(10);  // Show changes and keep the code to ~10 FPS.
-            callback -> update();
+            interpolate(&callback, fps);  // Keyframes at ~10 FPS, smoothed in between.
+            if(due()) {
+                callback.update();
+            }
         }
 
     private:  //////////////////////////////////////////////////////////////////////
@@ -40,7 +44,7 @@ class Matrix : public Effect {
         /**
          * Effect callback that will compute and show the matrix effect.
          */
-        class Callback : public FillCallback {
+        class Callback : public TintFillCallback<Callback, 0x20C420> {
 
             public:
 
@@ -48,60 +52,47 @@ class Matrix : public Effect {
                  * Constructor. Initialised the random dots around the matrix.
                  */
                 Callback() {
-                    for(uint16_t i = 0; i < num_leds; ++i) {
-                        dots[i] = random8(8) == 0;
+                    for(Coord j = 0; j < cols; ++j) {
+                        for(Coord i = 0; i < rows; ++i) {
+                            if(random8(8) == 0) {
+                                dots[j] |= row_bit(i);
+                            }
+                        }
                     }
                 }
 
-                /**
-                 * Callback function. Shows the matrix animation.
-                 *
-                 * @param i The row index.
-                 * @param j The column index.
-                 *
-                 * @returns An RGB colour to be set at the given coordinates.
-                 */
-                CRGB call(uint8_t i, uint8_t j) {
-                    return (((uint32_t) 0x20) * rain[index(i, j)] / 0xFF << 16) +  // Red.
-                           (((uint32_t) 0xC4) * rain[index(i, j)] / 0xFF << 8)  +  // Green.
-                            ((uint32_t) 0x20) * rain[index(i, j)] / 0xFF;          // Blue.
-                }
-
                 /**
                  * Create the next frame of the matrix-like animation.
                  */
                 void update() {
                     // Move up to 24 dots around randomly.
-                    for(uint8_t i = 0; i < 24; ++i) {
-                        uint16_t rand1 = random16(num_leds);
-                        uint16_t rand2 = random16(num_leds);
-                        if((dots[rand1] == true) && (dots[rand2] == false)) {
-                            dots[rand1] = false;
-                            dots[rand2] = true;
+                    for(uint8_t k = 0; k < 24; ++k) {
+                        Column &from = dots[random_coord(cols)];
+                        const Column from_bit = row_bit(random_coord(rows));
+                        Column &to = dots[random_coord(cols)];
+                        const Column to_bit = row_bit(random_coord(rows));
+                        if((from & from_bit) && !(to & to_bit)) {
+                            from &= ~from_bit;
+                            to |= to_bit;
                         }
                     }
 
                     // Fade.
-                    for(uint8_t i = 0; i < rows; ++i) {
-                        for(uint8_t j = 0; j < cols; ++j) {
-                            rain[index(i, j)] = qsub8(rain[index(i, j)], 0x30);
-                        }
+                    for(Index n = 0; n < num_leds; ++n) {
+                        intensity[n] = qsub8(intensity[n], 0x30);
                     }
 
-                    // Shift down.
-                    for(uint8_t j = 0; j < cols; ++j) {
-                        uint8_t foo = dots[index(0, j)];
-                        for(uint8_t i = 1; i < rows; ++i) {
-                            dots[index(i - 1, j)] = dots[index(i, j)];
-                        }
-                        dots[index(rows - 1, j)] = foo;
+                    // Shift down, wrapping the bottom row around to the top.
+                    for(Coord j = 0; j < cols; ++j) {
+                        dots[j] = (dots[j] >> 1) | ((dots[j] & 1) << (rows - 1));
                     }
 
                     // Show new spots.
-                    for(uint8_t i = 0; i < rows; ++i) {
-                        for(uint8_t j = 0; j < cols; ++j) {
-                            if(dots[index(i, j)]) {
-                                rain[index(i, j)] = 0xFF;
+                    for(Coord j = 0; j < cols; ++j) {
+                        Coord i = 0;
+                        for(Column spots = dots[j]; spots != 0; spots >>= 1, ++i) {
+                            if(spots & 1) {
+                                intensity[index(i, j)] = 0xFF;
                             }
                         }
                     }
@@ -110,34 +101,38 @@ class Matrix : public Effect {
             private:
 
                 /**
-                 * An array containing the heads for the falling columns.
+                 * A bit mask per column, with bit i set if there's a dot in row i.
                  */
-                bool dots[num_leds] = { };
+                typedef geometry::Mask<rows>::type Column;
+
                 /**
-                 * An array with the info to be shown. Contents define the intensity of each
-                 * pixel.
+                 * The heads for the falling columns, as a bit mask per column.
                  */
-                uint8_t rain[num_leds] = { };
+                Column dots[cols] = { };
 
                 /**
-                 * Compute the linear coordinate of a pixel in the array based on its real
-                 * position.
+                 * Get the mask for a single row in a column.
                  *
-                 * @param i The row coordinate of the pixel.
-                 * @param j The column coordinate of the pixel.
-                 *
-                 * @warning This will not validate the inputs, and using invalid coordinates
-                 *          results in undefined behaviour.
+                 * @param i The row index.
                  */
-                static uint16_t index(uint8_t i, uint8_t j) {
-                    return ((uint16_t) i) + ((uint16_t) j) * ((uint16_t) rows);
+                static Column row_bit(Coord i) {
+                    return ((Column) 1) << i;
                 }
         };
 
         /**
-         * The callback instance to be sent to the parent class.
+         * The callback instance to be sent to the parent class. Kept inline, so that
+         * effects never touch the heap.
+         */
+        Callback callback;
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The per pixel part of the effect, so that it can be layered with others (see
+         * compositor.h).
          */
-        Callback * const callback = new Callback();
+        typedef Callback Kernel;
 };
 
 #endif  // MATRIX_H_
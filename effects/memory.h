@@ -0,0 +1,139 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* SRAM usage monitoring.                                                       *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+
+#include <Arduino.h>  // Fixed width integer types and AVR registers.
+
+
+#if defined(__AVR__)
+// Symbols provided by the linker and avr-libc.
+extern uint8_t __heap_start;
+extern void *__brkval;
+#endif
+
+/**
+ * Keeps an eye on how close the stack gets to the heap. On an AVR the static data,
+ * the heap and the stack share the SRAM, the stack growing down towards the heap,
+ * and nothing stops them from running into each other.
+ *
+ * At boot all the free RAM between them is painted with a known value. The stack
+ * overwrites the paint as it grows, so the amount of paint left at the bottom tells
+ * how close the stack ever got to the heap.
+ *
+ * This needs the symbols provided by avr-libc and the linker. Elsewhere nothing is
+ * painted and every figure is 0.
+ */
+class Memory {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * Whether memory can be measured on this platform.
+         */
+#if defined(__AVR__)
+        static const bool supported = true;
+#else
+        static const bool supported = false;
+#endif
+
+        /**
+         * Value used to paint the free RAM.
+         */
+        static const uint8_t paint_byte = 0xA5;
+
+        /**
+         * Paint all of the free RAM, other than the top of the stack in use. To be
+         * called once, as early as possible.
+         */
+        static void paint() {
+#if defined(__AVR__)
+            for(uint8_t *p = heap_end(); p < ((uint8_t *) SP) - 32; ++p) {
+                *p = paint_byte;
+            }
+#endif
+        }
+
+        /**
+         * Get the size of the heap, i.e. memory taken through malloc() or new.
+         *
+         * @returns The size in bytes.
+         */
+        static uint16_t heap() {
+#if defined(__AVR__)
+            return heap_end() - &__heap_start;
+#else
+            return 0;
+#endif
+        }
+
+        /**
+         * Get the most stack ever used since the RAM was painted.
+         *
+         * @returns The stack high-water mark, in bytes.
+         */
+        static uint16_t stack_peak() {
+#if defined(__AVR__)
+            return ((uint8_t *) RAMEND) + 1 - untouched();
+#else
+            return 0;
+#endif
+        }
+
+        /**
+         * Get how close the stack ever got to the heap since the RAM was painted.
+         *
+         * @returns The bytes that were never used, 0 if they collided.
+         */
+        static uint16_t margin() {
+#if defined(__AVR__)
+            return untouched() - heap_end();
+#else
+            return 0;
+#endif
+        }
+
+        /**
+         * Get the memory left between the heap and the stack right now.
+         *
+         * @returns The free bytes.
+         */
+        static uint16_t available() {
+#if defined(__AVR__)
+            return ((uint8_t *) SP) - heap_end();
+#else
+            return 0;
+#endif
+        }
+
+#if defined(__AVR__)
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * First byte after the heap.
+         */
+        static uint8_t *heap_end() {
+            return (__brkval == nullptr) ? &__heap_start : (uint8_t *) __brkval;
+        }
+
+        /**
+         * Find the end of the paint, i.e. the lowest byte the stack ever reached. This
+         * goes through all the paint, so it takes a few hundred microseconds.
+         */
+        static uint8_t *untouched() {
+            uint8_t *p = heap_end();
+            while((p <= (uint8_t *) RAMEND) && (*p == paint_byte)) {
+                ++p;
+            }
+            return p;
+        }
+#endif
+};
+
+#endif  // MEMORY_H_
@@ -0,0 +1,224 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Implementation of flowing noise effects, like lava or clouds.                *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef NOISE_H_
+#define NOISE_H_
+
+#include "effect.h"  // Abstract effect structure.
+
+
+/**
+ * Effect implementation that shows slowly flowing 3D noise, coloured by a palette.
+ *
+ * Columns are points on a circle in the noise space, so the noise goes around the
+ * lamp without a seam, and rows go up along the third axis. Over time the noise
+ * rises, and the circle drifts through it so that the shapes change as they go.
+ *
+ * Noise is slow to compute, so it's only worked out for every other row and column,
+ * about a quarter of the LEDs, and only for keyframes. The LEDs in between are
+ * averaged from their neighbours when filling the buffer.
+ *
+ * @param P The palette. A type with a `static constexpr uint32_t colours[16]` (see
+ *          PaletteTable).
+ */
+template<class P> class Noise : public Effect {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The frame rate the effect is meant to run at.
+         */
+        static const uint8_t fps = 15;
+
+        /**
+         * Update the contents of the LED matrix.
+         */
+        void update() {
+            interpolate(&callback, fps);  // Keyframes at ~15 FPS, smoothed in between.
+            if(due()) {
+                callback.update();
+            }
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Effect callback that will compute and show the noise.
+         */
+        class Callback : public LinearFillCallback<Callback> {
+
+            public:
+
+                /**
+                 * Constructor. Places the columns in the noise space and samples the
+                 * first keyframe.
+                 */
+                Callback() {
+                    for(Coord k = 0; k < sample_cols; ++k) {
+                        if(Shape::cylinder) {
+                            const uint16_t angle = ((uint32_t) 2 * k << 16) / cols;
+                            x[k] = centre + (((int32_t) cos16(angle) * radius) >> 15);
+                            y[k] = centre + (((int32_t) sin16(angle) * radius) >> 15);
+                        } else {
+                            x[k] = centre + 2 * k * spacing;
+                            y[k] = centre;
+                        }
+                    }
+                    sample();
+                }
+
+                /**
+                 * Callback function. Shows the noise, averaging the samples around the
+                 * LEDs that weren't sampled.
+                 *
+                 * @param n The linear index of the pixel.
+                 * @param i The row index.
+                 * @param j The column index.
+                 *
+                 * @returns An RGB colour to be set at the given position.
+                 */
+                CRGB call(Index n, Coord i, Coord j) {
+                    uint8_t value = across(samples[i >> 1], j);
+                    if(i & 1) {
+                        value = (value + across(samples[(i >> 1) + 1], j) + 1) >> 1;
+                    }
+                    return PaletteTable<P>::get(value);
+                }
+
+                /**
+                 * Move the noise on, and sample the next keyframe.
+                 */
+                void update() {
+                    time += speed;
+                    drift += speed / 4;
+                    sample();
+                }
+
+            private:
+
+                /**
+                 * Rows and columns of samples. On a cylinder the last column of samples
+                 * is next to the first one, elsewhere there is one past the edge, and
+                 * there is always one more row above the top one.
+                 */
+                static const Coord sample_rows = rows / 2 + 1;
+                static const Coord sample_cols = Shape::cylinder ? (cols + 1) / 2 : cols / 2 + 1;
+
+                /**
+                 * Distance between neighbouring LEDs in the noise space, where 256 is the
+                 * size of a cell of the noise, and how far the noise moves every keyframe.
+                 */
+                static const uint16_t spacing = 48, speed = 12;
+
+                /**
+                 * Radius of the circle the columns are on, so that neighbouring columns
+                 * are `spacing` apart, and its centre.
+                 */
+                static const uint16_t radius = ((uint32_t) spacing * cols * 10430) >> 16;  // 1/2π.
+                static const uint16_t centre = 0x8000;
+
+                /**
+                 * Where each column of samples is in the noise space.
+                 */
+                uint16_t x[sample_cols], y[sample_cols];
+
+                /**
+                 * The samples of the current keyframe.
+                 */
+                uint8_t samples[sample_rows][sample_cols];
+
+                /**
+                 * How far the noise has risen, and how far the circle has drifted through
+                 * it, a quarter as fast. Both wrap around at 65536 units, where the noise
+                 * repeats, so neither ever jumps.
+                 */
+                uint16_t time = 0, drift = 0;
+
+                /**
+                 * Sample the noise for the current time. This is the slow part.
+                 */
+                void sample() {
+                    for(Coord r = 0; r < sample_rows; ++r) {
+                        const uint16_t z = 2 * r * spacing - time;  // Rising.
+                        for(Coord k = 0; k < sample_cols; ++k) {
+                            // Noise is mostly in the middle of the range, so stretch it.
+                            const uint8_t raw = qsub8(inoise8(x[k] + drift, y[k], z), 16);
+                            samples[r][k] = qadd8(raw, scale8(raw, 39));
+                        }
+                    }
+                }
+
+                /**
+                 * Get the value of a column in a row of samples, averaging the samples
+                 * on both sides for the columns that weren't sampled.
+                 *
+                 * @param row The row of samples.
+                 * @param j The column.
+                 */
+                static uint8_t across(const uint8_t *row, Coord j) {
+                    const Coord k = j >> 1;
+                    if(!(j & 1)) {
+                        return row[k];
+                    }
+                    const Coord next = (k + 1 < sample_cols) ? k + 1 : 0;  // Across the seam.
+                    return (row[k] + row[next] + 1) >> 1;
+                }
+        };
+
+        /**
+         * The callback instance, kept inline.
+         */
+        Callback callback;
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The per pixel part of the effect, so that it can be layered with others (see
+         * compositor.h).
+         */
+        typedef Callback Kernel;
+};
+
+namespace noise {
+
+    /**
+     * Glowing reds, with bright spots. Same as FastLED's LavaColors_p.
+     */
+    struct Lava {
+        static constexpr uint32_t colours[16] = {
+            0x000000, 0x800000, 0x000000, 0x800000,
+            0x8B0000, 0x8B0000, 0x800000, 0x8B0000,
+            0x8B0000, 0x8B0000, 0xFF0000, 0xFFA500,
+            0xFFFFFF, 0xFFA500, 0xFF0000, 0x8B0000,
+        };
+    };
+
+    /**
+     * Blues and whites. Same as FastLED's CloudColors_p.
+     */
+    struct Clouds {
+        static constexpr uint32_t colours[16] = {
+            0x0000FF, 0x00008B, 0x00008B, 0x00008B,
+            0x00008B, 0x00008B, 0x00008B, 0x00008B,
+            0x0000FF, 0x00008B, 0x87CEEB, 0x87CEEB,
+            0xADD8E6, 0xFFFFFF, 0xADD8E6, 0x87CEEB,
+        };
+    };
+}
+
+/**
+ * Lava flowing up the lamp.
+ */
+typedef Noise<noise::Lava> Lava;
+
+/**
+ * Clouds flowing up the lamp.
+ */
+typedef Noise<noise::Clouds> Clouds;
+
+#endif  // NOISE_H_
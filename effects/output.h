@@ -0,0 +1,218 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Split of the LED matrix across data pins.                                    *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef OUTPUT_H_
+#define OUTPUT_H_
+
+#include <FastLED.h>    // LED control library.
+
+#include "geometry.h"  // Shape of the matrix.
+
+
+#ifndef EFFECT_PINS
+/**
+ * The data pins driving the LED matrix, as a comma separated list. The columns are
+ * split in groups of consecutive ones, one group per pin, each wired as its own
+ * strip.
+ */
+#define EFFECT_PINS 13
+#endif
+
+#ifndef EFFECT_CORRECTION
+/**
+ * Colour correction of the LEDs, as a scale for each channel (0xRRGGBB). The default
+ * is FastLED's TypicalLEDStrip.
+ */
+#define EFFECT_CORRECTION 0xFFB0F0
+#endif
+
+#ifndef EFFECT_PARALLEL_OUTPUT
+/**
+ * Whether FastLED sends the data for all the pins at once. Its ESP32 driver does;
+ * on AVR the pins are clocked out one after the other.
+ */
+#if defined(ESP32)
+#define EFFECT_PARALLEL_OUTPUT 1
+#else
+#define EFFECT_PARALLEL_OUTPUT 0
+#endif
+#endif
+
+/**
+ * How the columns of the matrix are split across data pins. Each pin gets a segment
+ * of consecutive columns, which is a contiguous slice of the frame buffer as long as
+ * it is stored column by column.
+ *
+ * @param G The geometry of the matrix (see Geometry).
+ * @param pins The data pins, one per segment, starting from column 0.
+ */
+template<class G, uint8_t... pins> class Layout {
+
+    typedef typename G::Coord Coord;
+    typedef typename G::Index Index;
+
+    static const Coord rows = G::rows, cols = G::cols;
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The amount of segments.
+         */
+        static const uint8_t segments = sizeof...(pins);
+
+        /**
+         * The amount of columns in each segment. The last one may have less.
+         */
+        static const Coord span = (cols + segments - 1) / segments;
+
+        static_assert(segments > 0, "At least one data pin is needed");
+        static_assert((segments - 1) * span < cols, "Too many data pins for the amount of columns");
+        static_assert((segments == 1) || G::column_major,
+                      "Splitting across data pins needs the matrix stored column by column");
+
+        /**
+         * The geometry as it is wired: the same as G, except that a serpentine strip
+         * starts over at the first column of every segment, each pin driving a strip
+         * of its own. The first column of a segment always runs the same way, wherever
+         * the segment starts.
+         */
+        struct Wired : G {
+
+            /**
+             * Check whether a line of the strip runs backwards.
+             *
+             * @param line The line index.
+             */
+            static constexpr bool reversed(Coord line) {
+                return G::zigzag && (((G::column_major ? line % span : line) & 1) != 0);
+            }
+
+            /**
+             * Get the position of an LED in the frame buffer (see Geometry::index()).
+             */
+            static constexpr Index index(Coord i, Coord j) {
+                return G::column_major ?
+                       ((Index) j) * rows + (reversed(j) ? rows - 1 - i : i) :
+                       ((Index) i) * cols + (reversed(i) ? cols - 1 - j : j);
+            }
+
+            /**
+             * Get the row of the k-th LED in a line of the strip (see
+             * Geometry::line_row()).
+             */
+            static constexpr Coord line_row(Coord line, Coord k) {
+                return G::column_major ? (reversed(line) ? rows - 1 - k : k) : line;
+            }
+
+            /**
+             * Get the column of the k-th LED in a line of the strip (see
+             * Geometry::line_col()).
+             */
+            static constexpr Coord line_col(Coord line, Coord k) {
+                return G::column_major ? line : (reversed(line) ? cols - 1 - k : k);
+            }
+        };
+
+        /**
+         * Get the segment a column belongs to.
+         *
+         * @param j The column index.
+         */
+        static uint8_t segment(Coord j) {
+            return j / span;
+        }
+
+        /**
+         * Get the first column of a segment.
+         *
+         * @param k The segment index.
+         */
+        static Coord first(uint8_t k) {
+            return k * span;
+        }
+
+        /**
+         * Get the amount of columns in a segment.
+         *
+         * @param k The segment index.
+         */
+        static Coord width(uint8_t k) {
+            return k + 1 < segments ? span : cols - first(k);
+        }
+
+        /**
+         * Get the amount of LEDs in a segment.
+         *
+         * @param k The segment index.
+         */
+        static Index length(uint8_t k) {
+            return ((Index) width(k)) * rows;
+        }
+
+        /**
+         * Get the data pin of a segment.
+         *
+         * @param k The segment index.
+         */
+        static uint8_t pin(uint8_t k) {
+            static const uint8_t table[] = { pins... };
+            return table[k];
+        }
+
+        /**
+         * Time it takes to send some LEDs down a single pin, in microseconds. Each
+         * WS2812 LED takes 24 bits of 1.25µs, and then the strip needs 50µs to latch.
+         *
+         * @param leds The amount of LEDs sent.
+         */
+        static uint32_t time(Index leds) {
+            return 30UL * leds + 50;
+        }
+
+        /**
+         * Time it takes to send a whole frame, in microseconds. That's the longest
+         * segment if pins are driven in parallel, or all of them otherwise.
+         */
+        static uint32_t frame_time() {
+            uint32_t total = 0;
+            for(uint8_t k = 0; k < segments; ++k) {
+                const uint32_t taken = time(length(k));
+                total = EFFECT_PARALLEL_OUTPUT ? (taken > total ? taken : total) : total + taken;
+            }
+            return total;
+        }
+
+        /**
+         * Register one strip per segment with FastLED. The k-th registered controller
+         * drives the k-th segment.
+         *
+         * @param buffer The frame buffer, stored column by column.
+         */
+        static void attach(CRGB *buffer) {
+            Attach<0, pins...>::apply(buffer);
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Register the segments from k onwards, one for each of the given pins.
+         */
+        template<uint8_t k, uint8_t... rest> struct Attach {
+            static void apply(CRGB *buffer) { }
+        };
+
+        template<uint8_t k, uint8_t head, uint8_t... rest> struct Attach<k, head, rest...> {
+            static void apply(CRGB *buffer) {
+                FastLED.addLeds<WS2812, head, GRB>(buffer + G::index(0, first(k)), length(k))
+                       .setCorrection(CRGB(EFFECT_CORRECTION));
+                Attach<k + 1, rest...>::apply(buffer);
+            }
+        };
+};
+
+#endif  // OUTPUT_H_
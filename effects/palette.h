@@ -0,0 +1,197 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Colour palettes, and lookup tables with all of their interpolated colours.   *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef PALETTE_H_
+#define PALETTE_H_
+
+#include <avr/pgmspace.h>  // Allow access to PROGMEM.
+#include <FastLED.h>       // LED control library.
+
+
+#ifndef EFFECT_PALETTE_RAM_BUDGET
+/**
+ * How many bytes of SRAM a palette cache may use. A full cache takes 768 bytes, so
+ * this is 0 unless a build opts in.
+ */
+#define EFFECT_PALETTE_RAM_BUDGET 0
+#endif
+
+typedef TProgmemPalette16 ColourPalette;
+
+/**
+ * Compile time helpers to build lookup tables.
+ */
+namespace palette {
+
+    /**
+     * A list of indices.
+     */
+    template<uint16_t... N> struct Indices { };
+
+    /**
+     * Join two lists of indices, shifting the second one to follow the first.
+     */
+    template<class A, class B> struct Join;
+
+    template<uint16_t... A, uint16_t... B> struct Join<Indices<A...>, Indices<B...>> {
+        typedef Indices<A..., (sizeof...(A) + B)...> type;
+    };
+
+    /**
+     * Build the list of indices 0 .. N - 1. Done by halves to keep the template
+     * recursion shallow.
+     */
+    template<uint16_t N> struct Range {
+        typedef typename Join<typename Range<N / 2>::type, typename Range<N - N / 2>::type>::type type;
+    };
+
+    template<> struct Range<0> {
+        typedef Indices<> type;
+    };
+
+    template<> struct Range<1> {
+        typedef Indices<0> type;
+    };
+
+    /**
+     * Scale a number by a fraction of 256, exactly like FastLED's scale8().
+     */
+    constexpr uint8_t scale8(uint8_t i, uint8_t scale) {
+        return (((uint16_t) i) * (1 + (uint16_t) scale)) >> 8;
+    }
+
+    /**
+     * Get a channel out of a 0xRRGGBB colour.
+     */
+    constexpr uint8_t channel(uint32_t colour, uint8_t shift) {
+        return (colour >> shift) & 0xFF;
+    }
+
+    /**
+     * Blend two colour channels. f2 is the weight of the second one, out of 256.
+     */
+    constexpr uint8_t blend(uint8_t c1, uint8_t c2, uint8_t f2) {
+        return scale8(c1, 0xFF - f2) + scale8(c2, f2);
+    }
+
+    /**
+     * Get a channel of an interpolated palette colour, exactly like FastLED's
+     * ColorFromPalette(..., LINEARBLEND) does it.
+     *
+     * @param P A type with a `static constexpr uint32_t colours[16]`.
+     * @param index The virtual index for the colour to be computed.
+     * @param shift Which channel to get (16 for red, 8 for green, 0 for blue).
+     */
+    template<class P> constexpr uint8_t interpolate(uint8_t index, uint8_t shift) {
+        return (index & 0x0F) == 0 ?
+               channel(P::colours[index >> 4], shift) :
+               blend(channel(P::colours[index >> 4], shift),
+                     channel(P::colours[((index >> 4) + 1) & 0x0F], shift),
+                     (index & 0x0F) << 4);
+    }
+
+    /**
+     * Flash storage for a palette table. Entries are stored as consecutive R, G and
+     * B bytes.
+     */
+    template<class P, class I> struct Table;
+
+    template<class P, uint16_t... N> struct Table<P, Indices<N...>> {
+        static const uint8_t bytes[sizeof...(N)] PROGMEM;
+    };
+
+    template<class P, uint16_t... N>
+    const uint8_t Table<P, Indices<N...>>::bytes[sizeof...(N)] PROGMEM = {
+        interpolate<P>(N / 3, 16 - 8 * (N % 3))...
+    };
+}
+
+/**
+ * All 256 colours of a static 16 colour palette, computed at compile time and kept
+ * in flash. Looking a colour up costs 3 flash reads instead of a palette copy and a
+ * blend.
+ *
+ * @param P A type with a `static constexpr uint32_t colours[16]` holding the
+ *          palette, as 0xRRGGBB values.
+ */
+template<class P> class PaletteTable {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * Get a colour from the table.
+         *
+         * @param index The virtual index for the colour, as used with
+         *              ColorFromPalette().
+         *
+         * @returns The same colour ColorFromPalette(..., LINEARBLEND) would return.
+         */
+        static CRGB get(uint8_t index) {
+            const uint8_t *entry = Bytes::bytes + 3 * (uint16_t) index;
+            return CRGB(pgm_read_byte(entry), pgm_read_byte(entry + 1), pgm_read_byte(entry + 2));
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        typedef palette::Table<P, typename palette::Range<3 * 256>::type> Bytes;
+};
+
+/**
+ * Interpolated colours of a palette that is only known at run time, kept in SRAM.
+ * Costs 3 bytes per entry, so it has to fit in EFFECT_PALETTE_RAM_BUDGET.
+ *
+ * @param bits The table holds 2^bits evenly spread colours. Less bits trade colour
+ *             resolution for memory.
+ */
+template<uint8_t bits = 8> class PaletteCache {
+
+    static_assert((bits >= 1) && (bits <= 8), "Palette caches hold between 2 and 256 colours");
+    static_assert(3 * (1 << bits) <= EFFECT_PALETTE_RAM_BUDGET,
+                  "Palette cache does not fit in EFFECT_PALETTE_RAM_BUDGET");
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * Constructor. Expands the palette.
+         *
+         * @param palette The colour palette to be interpolated.
+         */
+        explicit PaletteCache(const CRGBPalette16 &palette) {
+            set(palette);
+        }
+
+        /**
+         * Expand a new palette into the cache.
+         *
+         * @param palette The colour palette to be interpolated.
+         */
+        void set(const CRGBPalette16 &palette) {
+            for(uint16_t n = 0; n < (1 << bits); ++n) {
+                entries[n] = ColorFromPalette(palette, n << (8 - bits), 0xFF, LINEARBLEND);
+            }
+        }
+
+        /**
+         * Get a colour from the cache.
+         *
+         * @param index The virtual index for the colour, as used with
+         *              ColorFromPalette().
+         */
+        CRGB get(uint8_t index) const {
+            return entries[index >> (8 - bits)];
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * The expanded colours.
+         */
+        CRGB entries[1 << bits];
+};
+
+#endif  // PALETTE_H_
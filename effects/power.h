@@ -0,0 +1,170 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Running estimate of the power drawn by the LEDs, and a limiter built on it.  *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef POWER_H_
+#define POWER_H_
+
+#include <FastLED.h>  // LED control library.
+
+
+#ifndef EFFECT_MAX_POWER
+/**
+ * The most power the LEDs and the board may draw, in milliwatts. The default is 2A
+ * at 5V. Set it to 0 to never limit the brightness.
+ */
+#define EFFECT_MAX_POWER 10000
+#endif
+
+/**
+ * Estimate of the power drawn by the LEDs, kept up to date as the frame buffer is
+ * written instead of worked out by going through it on every show, the way FastLED
+ * does with setMaxPowerInVoltsAndMilliamps().
+ *
+ * It keeps the sum of each channel over the whole frame buffer. Every write takes
+ * the old colour out of the sums and puts the new one in, so by the time a frame is
+ * shown the estimate, and whether the brightness has to come down to stay within
+ * EFFECT_MAX_POWER, are a handful of multiplications away. The model is FastLED's:
+ * a fixed draw per channel at full, one for LEDs that are off and one for the board.
+ *
+ * Writes that bypass the frame buffer helpers (see Effect::pixels()) can't tell
+ * what they overwrote, so they leave the sums stale and the next show goes through
+ * the buffer once to set them right.
+ *
+ * @param G The geometry of the matrix (see Geometry).
+ */
+template<class G> class PowerMeter {
+
+    typedef typename G::Index Index;
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * Note that an LED changed colour.
+         *
+         * @param from The colour it had.
+         * @param to The colour it has now.
+         */
+        static void replace(const CRGB &from, const CRGB &to) {
+            red += (int16_t) to.r - from.r;
+            green += (int16_t) to.g - from.g;
+            blue += (int16_t) to.b - from.b;
+        }
+
+        /**
+         * Note that the whole frame buffer was filled with a single colour.
+         *
+         * @param colour The colour.
+         */
+        static void reset(const CRGB &colour) {
+            red = (uint32_t) colour.r * G::num_leds;
+            green = (uint32_t) colour.g * G::num_leds;
+            blue = (uint32_t) colour.b * G::num_leds;
+            stale = false;
+        }
+
+        /**
+         * Note that LEDs were written without going through replace().
+         */
+        static void invalidate() {
+            stale = true;
+        }
+
+        /**
+         * Work out the brightness to show the next frame at, which is the one asked for
+         * unless that would draw more than EFFECT_MAX_POWER. Same as FastLED's
+         * calculate_max_brightness_for_power_mW(), without going through the LEDs.
+         *
+         * @param leds The frame buffer, only read if the sums are stale.
+         * @param target The brightness asked for.
+         *
+         * @returns The brightness to use.
+         */
+        static uint8_t limit(const CRGB *leds, uint8_t target) {
+            if(stale) {
+                recount(leds);
+            }
+
+            const uint32_t total = mcu_mw + dark_mw * G::num_leds + ((red * red_mw) >> 8) +
+                                   ((green * green_mw) >> 8) + ((blue * blue_mw) >> 8);
+            last = (total * target) / 256;
+            if((EFFECT_MAX_POWER == 0) || (last <= EFFECT_MAX_POWER)) {
+                return target;
+            }
+
+            ++throttles;
+            return (target * (uint32_t) EFFECT_MAX_POWER) / last;
+        }
+
+        /**
+         * Get the power the last frame shown would have drawn at the brightness asked
+         * for, before limiting it.
+         *
+         * @returns The estimate, in milliwatts.
+         */
+        static uint32_t requested() {
+            return last;
+        }
+
+        /**
+         * Get how many frames had their brightness lowered to stay within the limit.
+         * It wraps around, so compare it with an earlier reading.
+         */
+        static uint16_t throttled() {
+            return throttles;
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Power drawn by each channel at full, and by an LED that is off, in milliwatts
+         * at 5V, plus the board itself. Same as FastLED's.
+         */
+        static const uint32_t red_mw = 16 * 5, green_mw = 11 * 5, blue_mw = 15 * 5,
+                              dark_mw = 1 * 5, mcu_mw = 25 * 5;
+
+        /**
+         * The sum of each channel over the frame buffer.
+         */
+        static uint32_t red, green, blue;
+
+        /**
+         * Whether the sums have to be worked out again.
+         */
+        static bool stale;
+
+        /**
+         * The last estimate, and how many frames were throttled so far.
+         */
+        static uint32_t last;
+        static uint16_t throttles;
+
+        /**
+         * Work out the sums by going through the frame buffer.
+         *
+         * @param leds The frame buffer.
+         */
+        static void recount(const CRGB *leds) {
+            red = green = blue = 0;
+            for(Index n = 0; n < G::num_leds; ++n) {
+                red += leds[n].r;
+                green += leds[n].g;
+                blue += leds[n].b;
+            }
+            stale = false;
+        }
+};
+
+// Allocate the estimate. The frame buffer starts black.
+template<class G> uint32_t PowerMeter<G>::red = 0;
+template<class G> uint32_t PowerMeter<G>::green = 0;
+template<class G> uint32_t PowerMeter<G>::blue = 0;
+template<class G> bool PowerMeter<G>::stale = false;
+template<class G> uint32_t PowerMeter<G>::last = 0;
+template<class G> uint16_t PowerMeter<G>::throttles = 0;
+
+#endif  // POWER_H_
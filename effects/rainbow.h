@@ -20,40 +20,62 @@ class Rainbow : public Effect {
     public:  ///////////////////////////////////////////////////////////////////////
 
         /**
-         * Destructor. Free up resources.
+         * The frame rate the effect is meant to run at.
          */
-        ~Rainbow() {
-            delete callback;
-        }
+        static const uint8_t fps = 2;
 
         /**
          * Update the contents of the LED matrix.
          */
         void update() {
-            fill(callback);
-            show(2);  // Show changes and keep the code to ~2 FPS.
-            callback -> update();
+            interpolate(callback.colour(), fps);  // Keyframes at ~2 FPS, smoothed in between.
+            if(due()) {
+                callback.update();  // Shift to the next colour.
+            }
         }
 
     private:  //////////////////////////////////////////////////////////////////////
 
         /**
-         * Effect callback that will compute and show the correct colour.
+         * The colours to cycle through. Same as FastLED's RainbowColors_p, but known at
+         * compile time so all 256 colours can be precomputed in flash.
          */
-        class Callback : public FillCallback {
+        struct Palette {
+            static constexpr uint32_t colours[16] = {
+                0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00,
+                0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+                0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5,
+                0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B,
+            };
+        };
+
+        /**
+         * Effect callback that keeps track of the colour being shown. The effect fills
+         * the matrix with a uniform colour instead, but layered effects need a
+         * colour per pixel.
+         */
+        class Callback : public LinearFillCallback<Callback> {
 
             public:
 
                 /**
-                 * Callback function. Shows the current colour.
+                 * Get the current colour.
+                 */
+                CRGB colour() const {
+                    return current;
+                }
+
+                /**
+                 * Callback function. Every pixel shows the same colour.
                  *
+                 * @param n The linear index of the pixel.
                  * @param i The row index.
                  * @param j The column index.
                  *
-                 * @returns An RGB colour to be set at the given coordinates.
+                 * @returns An RGB colour to be set at the given position.
                  */
-                CRGB call(uint8_t i, uint8_t j) {
-                    return interpolate_colour(RainbowColors_p, index);
+                CRGB call(Index n, Coord i, Coord j) {
+                    return current;
                 }
 
                 /**
@@ -61,20 +83,30 @@ class Rainbow : public Effect {
                  */
                 void update() {
                     index += 1;
+                    current = PaletteTable<Palette>::get(index);
                 }
 
             private:
 
                 /**
-                 * The current colour to be shown.
+                 * The current colour to be shown, and its position in the palette.
                  */
                 uint8_t index = 0;
+                CRGB current = PaletteTable<Palette>::get(0);
         };
 
         /**
-         * The callback instance to be sent to the parent class.
+         * The callback instance, kept inline.
+         */
+        Callback callback;
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The per pixel part of the effect, so that it can be layered with others (see
+         * compositor.h).
          */
-        Callback * const callback = new Callback();
+        typedef Callback Kernel;
 };
 
 #endif  // RAINBOW_H_
@@ -0,0 +1,475 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Frames streamed from a computer over serial.                                 *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef REMOTE_H_
+#define REMOTE_H_
+
+#include "effect.h"  // Abstract effect structure.
+
+
+/**
+ * Effect that shows frames sent from a computer over serial (see host/stream.py),
+ * e.g. for pre-rendered shows. Frames are decoded byte by byte as they arrive,
+ * straight into the frame buffer, so there is no copy of the frame anywhere else.
+ *
+ * Sending data to the LEDs disables interrupts for several milliseconds, long enough
+ * to lose incoming bytes, so the lamp paces the computer: it acknowledges every
+ * packet once it's done with it, and the computer only sends a packet after getting
+ * the acknowledgement for the previous one. Frames thus arrive as fast as the link
+ * allows, up to `fps`.
+ *
+ * Packets, with 16 bit values little endian:
+ *
+ *     sync      2  0x5A 0xA5
+ *     type      1  one of Type
+ *     sequence  1  one more than the previous packet, wrapping around
+ *     length    2  size of the payload
+ *     payload      as given by the type, LEDs in storage order (see Effect::index())
+ *     checksum  1  xor of everything after the sync
+ *
+ * Acknowledgements are 6 bytes: 0x06, the sequence of the packet, a status (bit 0
+ * set while a key frame is needed), the dropped and late frame counters (wrapping
+ * around) and the xor of the previous 4 bytes. Before the first packet an
+ * acknowledgement with sequence 0xFF says the lamp is ready.
+ *
+ * Serial commands (see lamp.ino) can't be told apart from frames while streaming, so
+ * they are sent in a command packet instead, and passed on by command(). This way a
+ * stream can always be left from the computer.
+ *
+ * A packet that fails its checksum, or doesn't make up a whole frame, may have
+ * been partly written already. It is not shown, and deltas are ignored until the
+ * next key frame (any frame but a delta), as are deltas after a lost packet. The
+ * palette of a palette frame is only taken once the whole packet checks out, so a
+ * rejected packet never changes the palette later frames reuse.
+ */
+class Remote : public Effect {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The highest frame rate frames are shown at.
+         */
+        static const uint8_t fps = 30;
+
+        /**
+         * The kinds of packets.
+         */
+        enum Type : uint8_t {
+            FRAME_FULL    = 1,  // R, G and B of every LED.
+            FRAME_DELTA   = 2,  // Runs of changed LEDs: LEDs to skip, LEDs in the run, their RGB.
+            FRAME_RLE     = 3,  // Runs of a single colour: LEDs in the run, RGB.
+            FRAME_PALETTE = 4,  // Colours in the palette (0 keeps the last one), their RGB,
+                                // then runs of a palette colour: LEDs in the run, index.
+            COMMAND       = 5,  // A serial command, e.g. `n`. Not a frame.
+        };
+
+        /**
+         * The most colours a palette frame can have.
+         */
+        static const uint8_t max_colours = 16;
+
+        /**
+         * Update the contents of the LED matrix with the next frame, if it arrives in
+         * time. Otherwise return, so the loop keeps running, and carry on next time.
+         */
+        void update() {
+            if(!owns()) {
+                // Deltas are decoded over the previous frame, so wait until nothing is
+                // blended into the buffer. Leftovers of a stream are thrown away.
+                while(Serial.available() > 0) {
+                    Serial.read();
+                }
+                fill(CRGB::Black);
+                present(fps);
+                acknowledged = false;
+                return;
+            }
+
+            if(!acknowledged) {
+                acknowledged = true;
+                stale = true;
+                scheduler = Scheduler();  // Waiting for a stream to start isn't being late.
+                acknowledge(0xFF);
+            }
+
+            EFFECT_PROBE(PHASE_FILL);
+            const uint32_t begin = micros();
+            bool ended = false;
+            while(!ended) {
+                if(Serial.available() > 0) {
+                    ended = receive(Serial.read());
+                } else if(micros() - begin >= 1000000UL / fps) {
+                    break;
+                }
+            }
+            EFFECT_PROBE(PHASE_EFFECT);
+
+            if(ended) {
+                if(!bad && (type != COMMAND)) {
+                    present(fps);
+                }
+                acknowledge(sequence);
+            }
+        }
+
+        /**
+         * Get the serial command sent in the last command packet, if it wasn't taken
+         * yet.
+         *
+         * @returns The command, or -1 if there's none.
+         */
+        int command() {
+            const int taken = request > 0 ? request : -1;
+            request = 0;
+            return taken;
+        }
+
+        /**
+         * Get the amount of packets lost or rejected.
+         *
+         * @returns The dropped frame counter. Wraps around on overflow.
+         */
+        uint16_t dropped() const {
+            return drops;
+        }
+
+        /**
+         * Get the amount of frames that were shown after their deadline, because they
+         * didn't arrive in time.
+         *
+         * @returns The late frame counter. Wraps around on overflow.
+         */
+        uint16_t late() const {
+            return overruns();
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Where the decoder is in a packet.
+         */
+        enum State : uint8_t {
+            STATE_SYNC,
+            STATE_SYNC2,
+            STATE_TYPE,
+            STATE_SEQUENCE,
+            STATE_LENGTH,
+            STATE_LENGTH2,
+            STATE_PAYLOAD,
+            STATE_CHECKSUM,
+        };
+
+        /**
+         * The decoder state, and the header of the packet being decoded.
+         */
+        State state = STATE_SYNC;
+        uint8_t type = 0, sequence = 0xFF, checksum = 0;
+        uint16_t length = 0;
+
+        /**
+         * Whether the packet being decoded is written to the buffer, and whether it is
+         * wrong.
+         */
+        bool writing = false, bad = false;
+
+        /**
+         * Whether the frame buffer doesn't hold the frame the computer thinks it does,
+         * so a key frame is needed.
+         */
+        bool stale = true;
+
+        /**
+         * Whether the lamp said it's ready since it last took the LEDs over.
+         */
+        bool acknowledged = false;
+
+        /**
+         * Next LED to be written, and the LEDs written so far by the current packet.
+         */
+        Index cursor = 0, low = 0, high = 0;
+
+        /**
+         * The bytes of the current unit of the payload (e.g. an RGB triplet), and
+         * how many of them were received.
+         */
+        uint8_t unit[4];
+        uint8_t got = 0;
+
+        /**
+         * LEDs left in the current delta run, or palette colours left to be received.
+         */
+        uint8_t run = 0;
+
+        /**
+         * The palette of palette frames, and its size, 0 until one is received.
+         */
+        CRGB palette[max_colours];
+        uint8_t colours = 0;
+
+        /**
+         * The palette sent with the current frame, and its size, 0 if it reuses the
+         * last one. Only taken as the palette once the packet checks out.
+         */
+        CRGB incoming[max_colours];
+        uint8_t incoming_colours = 0;
+
+        /**
+         * Whether the size of the palette of the current frame is still to come.
+         */
+        bool header = false;
+
+        /**
+         * The command of the current command packet, and the last one received until it
+         * is taken, or 0.
+         */
+        uint8_t incoming_request = 0, request = 0;
+
+        /**
+         * Packets lost or rejected.
+         */
+        uint16_t drops = 0;
+
+        /**
+         * Feed a received byte to the decoder.
+         *
+         * @param byte The byte.
+         *
+         * @returns Whether a packet just ended.
+         */
+        bool receive(uint8_t byte) {
+            if(state > STATE_SYNC2) {
+                checksum ^= byte;
+            }
+
+            switch(state) {
+                case STATE_SYNC:
+                    state = byte == 0x5A ? STATE_SYNC2 : STATE_SYNC;
+                    return false;
+
+                case STATE_SYNC2:
+                    state = byte == 0xA5 ? STATE_TYPE : (byte == 0x5A ? STATE_SYNC2 : STATE_SYNC);
+                    checksum = 0;
+                    return false;
+
+                case STATE_TYPE:
+                    type = byte;
+                    state = STATE_SEQUENCE;
+                    return false;
+
+                case STATE_SEQUENCE:
+                    if(byte != (uint8_t) (sequence + 1)) {
+                        drops += (uint8_t) (byte - sequence - 1);
+                        stale = true;
+                    }
+                    sequence = byte;
+                    state = STATE_LENGTH;
+                    return false;
+
+                case STATE_LENGTH:
+                    length = byte;
+                    state = STATE_LENGTH2;
+                    return false;
+
+                case STATE_LENGTH2:
+                    length |= ((uint16_t) byte) << 8;
+                    start();
+                    if(length > 4 * num_leds + 1 + 3 * max_colours) {
+                        // Can't be right. Most likely a lost sync, so look for the next one.
+                        ++drops;
+                        stale = true;
+                        bad = true;
+                        state = STATE_SYNC;
+                        return true;
+                    }
+                    state = length > 0 ? STATE_PAYLOAD : STATE_CHECKSUM;
+                    return false;
+
+                case STATE_PAYLOAD:
+                    if(writing) {
+                        decode(byte);
+                    }
+                    if(--length == 0) {
+                        state = STATE_CHECKSUM;
+                    }
+                    return false;
+
+                case STATE_CHECKSUM:
+                    state = STATE_SYNC;
+                    finish(checksum == 0);  // The checksum byte cancels out.
+                    return true;
+            }
+            return false;
+        }
+
+        /**
+         * Get ready to decode the payload of a packet.
+         */
+        void start() {
+            cursor = 0;
+            low = num_leds;
+            high = 0;
+            got = 0;
+            run = 0;
+            header = type == FRAME_PALETTE;
+            incoming_colours = 0;
+            incoming_request = 0;
+
+            const bool known = (type >= FRAME_FULL) && (type <= COMMAND);
+            writing = known && !(stale && (type == FRAME_DELTA));
+            bad = !writing;
+        }
+
+        /**
+         * Decode a byte of the payload of a packet.
+         *
+         * @param byte The byte.
+         */
+        void decode(uint8_t byte) {
+            unit[got++] = byte;
+
+            switch(type) {
+                case FRAME_FULL:
+                    if(got == 3) {
+                        put(CRGB(unit[0], unit[1], unit[2]), 1);
+                    }
+                    break;
+
+                case FRAME_DELTA:
+                    if(run == 0) {
+                        if(got == 2) {
+                            cursor += unit[0];
+                            run = unit[1];
+                            got = 0;
+                        }
+                    } else if(got == 3) {
+                        put(CRGB(unit[0], unit[1], unit[2]), 1);
+                        --run;
+                    }
+                    break;
+
+                case FRAME_RLE:
+                    if(got == 4) {
+                        put(CRGB(unit[1], unit[2], unit[3]), unit[0]);
+                    }
+                    break;
+
+                case FRAME_PALETTE:
+                    if(header) {
+                        header = false;
+                        got = 0;
+                        if(byte > max_colours) {
+                            bad = true;
+                            writing = false;
+                        } else if(byte > 0) {
+                            incoming_colours = byte;
+                            run = byte;
+                        }
+                    } else if(run > 0) {
+                        if(got == 3) {
+                            incoming[incoming_colours - run] = CRGB(unit[0], unit[1], unit[2]);
+                            --run;
+                            got = 0;
+                        }
+                    } else if(got == 2) {
+                        const CRGB *const current = incoming_colours > 0 ? incoming : palette;
+                        const uint8_t size = incoming_colours > 0 ? incoming_colours : colours;
+                        if(unit[1] < size) {
+                            put(current[unit[1]], unit[0]);
+                        } else {
+                            bad = true;
+                            writing = false;
+                        }
+                    }
+                    break;
+
+                case COMMAND:
+                    got = 0;
+                    bad |= incoming_request != 0;  // Only one per packet.
+                    incoming_request = byte;
+                    break;
+            }
+        }
+
+        /**
+         * Write a run of LEDs of the same colour at the cursor, and move past them.
+         *
+         * @param colour The colour.
+         * @param count The amount of LEDs.
+         */
+        void put(CRGB colour, uint8_t count) {
+            got = 0;
+            if(cursor + count > num_leds) {
+                bad = true;
+                writing = false;
+                return;
+            }
+
+            CRGB *leds = pixels() + cursor;
+            for(uint8_t k = 0; k < count; ++k) {
+                leds[k] = colour;
+            }
+            low = cursor < low ? cursor : low;
+            cursor += count;
+            high = cursor;
+        }
+
+        /**
+         * Wrap up a packet once it's all been received.
+         *
+         * @param valid Whether its checksum matched.
+         */
+        void finish(bool valid) {
+            if(high > low) {
+                changed(low, high - low);
+            }
+
+            const bool whole = (got == 0) && (run == 0) && !header;
+            const bool complete = whole && ((type == FRAME_DELTA) || (cursor == num_leds));
+            if(type == COMMAND) {
+                // Nothing was drawn, so whatever the lamp shows is still what the
+                // computer thinks it does.
+                if(valid && !bad && (incoming_request != 0)) {
+                    request = incoming_request;
+                } else {
+                    ++drops;
+                }
+                return;
+            }
+
+            bad |= !valid || !complete;
+            if(bad) {
+                // Whatever the computer sends next has to start over from a key frame
+                // and a new palette, as it can't tell what this one left behind.
+                ++drops;
+                stale = true;
+                return;
+            }
+
+            if(incoming_colours > 0) {
+                memcpy(palette, incoming, sizeof(palette));
+                colours = incoming_colours;
+            }
+            if(type != FRAME_DELTA) {
+                stale = false;
+            }
+        }
+
+        /**
+         * Tell the computer that a packet was dealt with, and that the next one can be
+         * sent.
+         *
+         * @param which The sequence of the packet.
+         */
+        void acknowledge(uint8_t which) {
+            uint8_t ack[6] = { 0x06, which, stale, lowByte(drops), lowByte(late()) };
+            ack[5] = ack[1] ^ ack[2] ^ ack[3] ^ ack[4];
+            Serial.write(ack, sizeof(ack));
+        }
+};
+
+#endif  // REMOTE_H_
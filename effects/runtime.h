@@ -0,0 +1,323 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Effect runtime, running one of a set of effects out of a static arena.       *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RUNTIME_H_
+#define RUNTIME_H_
+
+#include <new.h>     // Placement new.
+
+#include "effect.h"      // Abstract effect structure.
+#include "transition.h"  // Fading between effects.
+
+
+#ifndef LAMP_TRANSITION_MS
+/**
+ * How long switching effects takes, in milliseconds. Both effects are kept alive
+ * while fading from one to the other. Set it to 0 to switch at once, which halves
+ * the arena.
+ */
+#define LAMP_TRANSITION_MS 1000
+#endif
+
+#ifndef LAMP_ARENA_BUDGET
+/**
+ * How many bytes of SRAM the effect arena may use. The arena holds a single effect
+ * at a time, or two while fading between them, so it only needs to fit the largest
+ * one once or twice.
+ */
+#define LAMP_ARENA_BUDGET 640
+#endif
+
+/**
+ * Compile time helpers for the runtime.
+ */
+namespace runtime {
+
+    /**
+     * The larger of two sizes.
+     */
+    constexpr size_t larger(size_t a, size_t b) {
+        return a > b ? a : b;
+    }
+
+    /**
+     * The size and alignment of the largest of a list of types.
+     */
+    template<class... T> struct Largest;
+
+    template<> struct Largest<> {
+        static constexpr size_t size = 1;
+        static constexpr size_t align = 1;
+    };
+
+    template<class T, class... U> struct Largest<T, U...> {
+        static constexpr size_t size = larger(sizeof(T), Largest<U...>::size);
+        static constexpr size_t align = larger(alignof(T), Largest<U...>::align);
+    };
+
+    /**
+     * The position of a type in a list of types.
+     */
+    template<class T, class... U> struct IndexOf;
+
+    template<class T, class... U> struct IndexOf<T, T, U...> {
+        static constexpr uint8_t value = 0;
+    };
+
+    template<class T, class V, class... U> struct IndexOf<T, V, U...> {
+        static constexpr uint8_t value = 1 + IndexOf<T, U...>::value;
+    };
+
+    /**
+     * The size of the n-th of a list of types.
+     */
+    template<class... T> struct SizeOf;
+
+    template<> struct SizeOf<> {
+        static size_t of(uint8_t n) {
+            return 0;
+        }
+    };
+
+    template<class T, class... U> struct SizeOf<T, U...> {
+        static size_t of(uint8_t n) {
+            return n == 0 ? sizeof(T) : SizeOf<U...>::of(n - 1);
+        }
+    };
+
+    /**
+     * The frame rate the n-th of a list of effects is meant to run at.
+     */
+    template<class... T> struct RateOf;
+
+    template<> struct RateOf<> {
+        static uint8_t of(uint8_t n) {
+            return 0;
+        }
+    };
+
+    template<class T, class... U> struct RateOf<T, U...> {
+        static uint8_t of(uint8_t n) {
+            return n == 0 ? T::fps : RateOf<U...>::of(n - 1);
+        }
+    };
+
+    /**
+     * Construct the n-th of a list of effects in place.
+     */
+    template<class... T> struct Factory;
+
+    template<> struct Factory<> {
+        static Effect *make(uint8_t n, void *arena) {
+            return nullptr;
+        }
+    };
+
+    template<class T, class... U> struct Factory<T, U...> {
+        static Effect *make(uint8_t n, void *arena) {
+            return n == 0 ? new(arena) T() : Factory<U...>::make(n - 1, arena);
+        }
+    };
+}
+
+/**
+ * Runs one effect at a time out of a fixed set. The running effect lives in a
+ * statically allocated arena sized for the largest of them, so switching effects
+ * never touches the heap and can't fragment it. Unless LAMP_TRANSITION_MS is 0 the
+ * arena has room for two, so that the old effect can fade into the new one.
+ *
+ * @param Effects The effects that can be run, all of them subclasses of Effect.
+ */
+template<class... Effects> class Runtime {
+
+    static_assert(sizeof...(Effects) > 0, "The runtime needs at least one effect");
+    static_assert((LAMP_TRANSITION_MS > 0 ? 2 : 1) * runtime::Largest<Effects...>::size
+                  <= LAMP_ARENA_BUDGET, "The largest effects do not fit in LAMP_ARENA_BUDGET");
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The amount of effects available.
+         */
+        static const uint8_t count = sizeof...(Effects);
+
+        /**
+         * How many effects the arena can hold at once.
+         */
+        static const uint8_t slots = LAMP_TRANSITION_MS > 0 ? 2 : 1;
+
+        /**
+         * The amount of memory taken by each slot of the arena, in bytes.
+         */
+        static const size_t size = runtime::Largest<Effects...>::size;
+
+        /**
+         * Get how much of the arena an effect takes. Along with the frame buffer shared
+         * by all effects, this is all the SRAM an effect needs besides the stack.
+         *
+         * @param n The position of the effect in the list.
+         *
+         * @returns The size of the effect in bytes, or 0 if there's no such effect.
+         */
+        static size_t footprint(uint8_t n) {
+            return runtime::SizeOf<Effects...>::of(n);
+        }
+
+        /**
+         * Destructor. Stops the current effect.
+         */
+        ~Runtime() {
+            stop();
+        }
+
+        /**
+         * Switch to another effect. The new one is built in the free slot, and the
+         * current one fades out and is destroyed once the transition is over. Without
+         * transitions, the current one is destroyed first and the new one is built in
+         * its place.
+         *
+         * @param n The position of the effect in the list, wrapping around if too
+         *          large.
+         */
+        void select(uint8_t n) {
+            finish();
+            const uint8_t previous = current;
+            current = n % count;
+
+            if((slots > 1) && (effect != nullptr)) {
+                outgoing = effect;
+                slot = (slot + 1) % slots;
+                effect = runtime::Factory<Effects...>::make(current, arena[slot]);
+                transition.start(outgoing, runtime::RateOf<Effects...>::of(previous),
+                                 effect, runtime::RateOf<Effects...>::of(current));
+            } else {
+                stop();
+                slot = 0;
+                effect = runtime::Factory<Effects...>::make(current, arena[slot]);
+            }
+        }
+
+        /**
+         * Switch to an effect given its type.
+         *
+         * @param T The effect to be run. Must be one of the runtime's effects.
+         */
+        template<class T> void start() {
+            select(runtime::IndexOf<T, Effects...>::value);
+        }
+
+        /**
+         * Switch to the effect following the current one, wrapping around after the
+         * last one.
+         */
+        void next() {
+            select(current + 1);
+        }
+
+        /**
+         * Destroy the current effect, if any. Nothing is shown until another one is
+         * selected.
+         */
+        void stop() {
+            finish();
+            if(effect != nullptr) {
+                effect -> ~Effect();
+                effect = nullptr;
+            }
+        }
+
+        /**
+         * Update the current effect, if any.
+         */
+        void update() {
+            if(outgoing != nullptr) {
+                transition.update();
+                if(!transition.running()) {
+                    finish();
+                }
+            } else if(effect != nullptr) {
+                effect -> update();
+            }
+        }
+
+        /**
+         * Get the running effect.
+         *
+         * @returns The effect, or null if none is running.
+         */
+        Effect *get() const {
+            return effect;
+        }
+
+        /**
+         * Get the position of the running effect in the list.
+         */
+        uint8_t selected() const {
+            return current;
+        }
+
+        /**
+         * Check whether an effect is the selected one.
+         *
+         * @param T The effect. Must be one of the runtime's effects.
+         */
+        template<class T> bool is() const {
+            return current == runtime::IndexOf<T, Effects...>::value;
+        }
+
+        /**
+         * Get the transition between effects, e.g. to check what it costs.
+         */
+        const Transition &fader() const {
+            return transition;
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Storage for the running effect, and for the outgoing one during transitions.
+         */
+        alignas(runtime::Largest<Effects...>::align) uint8_t arena[slots][size];
+
+        /**
+         * The running effect, placed inside the arena, or null.
+         */
+        Effect *effect = nullptr;
+
+        /**
+         * The effect being faded out, placed inside the other slot of the arena, or null.
+         */
+        Effect *outgoing = nullptr;
+
+        /**
+         * The slot holding the running effect.
+         */
+        uint8_t slot = 0;
+
+        /**
+         * Fades from the outgoing effect to the running one.
+         */
+        Transition transition { LAMP_TRANSITION_MS };
+
+        /**
+         * End the transition in progress, if any, by destroying the outgoing effect.
+         */
+        void finish() {
+            if(outgoing != nullptr) {
+                outgoing -> ~Effect();
+                outgoing = nullptr;
+            }
+        }
+
+        /**
+         * The position of the running effect in the list.
+         */
+        uint8_t current = 0;
+};
+
+#endif  // RUNTIME_H_
@@ -0,0 +1,30 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Effects made by layering other effects.                                      *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef SCENES_H_
+#define SCENES_H_
+
+#include "compositor.h"  // Layering of effects.
+#include "fire.h"        // The effects being layered.
+#include "matrix.h"
+#include "rainbow.h"
+#include "stars.h"
+
+
+/**
+ * Stars twinkling over a dim rainbow.
+ */
+typedef Compositor<Layer<Rainbow, BLEND_ALPHA, 0x40>, Layer<Stars, BLEND_SCREEN>> StarryRainbow;
+
+/**
+ * The matrix rain over a dim fire. Holds the state of both, so it needs about twice
+ * the memory of other effects.
+ */
+typedef Compositor<Layer<Fire, BLEND_ALPHA, 0x60>, Layer<Matrix, BLEND_MAX>> MatrixFire;
+
+#endif  // SCENES_H_
@@ -0,0 +1,231 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Frame scheduler, keeping a steady frame rate.                                *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include <Arduino.h>  // Timing functions.
+
+
+/**
+ * Keeps track of absolute frame deadlines, so that the time spent computing and
+ * showing a frame is taken out of the wait rather than added to it, and rounding
+ * errors do not accumulate.
+ */
+class Scheduler {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * What to do when a frame is ready after its deadline.
+         */
+        enum Overrun : uint8_t {
+            OVERRUN_SKIP,      // Drop the missed deadlines and restart the schedule from now.
+            OVERRUN_CATCH_UP,  // Keep the schedule, running frames without waiting until back on time.
+        };
+
+        /**
+         * How many frames behind schedule catching up is still attempted. Past this the
+         * schedule is restarted, as with OVERRUN_SKIP.
+         */
+        static const uint8_t max_lag = 4;
+
+        /**
+         * Get the current time. This is micros(), corrected for the time lost while
+         * interrupts were disabled (see compensate()). There is a single such clock,
+         * shared by all schedulers and by anything else timing frames.
+         *
+         * @returns The current time, in microseconds.
+         */
+        static uint32_t now() {
+            return micros() + lost;
+        }
+
+        /**
+         * Make up for the clock ticks lost while interrupts were disabled, as happens
+         * while sending data to the LEDs.
+         *
+         * @param since When the operation started, as returned by now().
+         * @param expected How long the operation is known to take, in microseconds.
+         */
+        static void compensate(uint32_t since, uint32_t expected) {
+            const uint32_t taken = now() - since;
+            if(taken < expected) {
+                lost += expected - taken;
+            }
+        }
+
+        /**
+         * Move on to the next frame deadline. The first call starts the schedule.
+         *
+         * @param fps The desired frame rate.
+         */
+        void next(uint8_t fps) {
+            const uint32_t now = this -> now();
+            const bool first = !started;
+            period = 1000000UL / fps;
+
+            if(first) {
+                started = true;
+                deadline = now;
+                window_start = now;
+            }
+
+            // The frame was due at the deadline it waited for. Windows are timed by that
+            // rather than by now, which also has whatever this frame spent on showing,
+            // and not every frame shows.
+            const uint32_t due = deadline;
+
+            // Keep the fractional microseconds, so that e.g. 60 FPS does not drift.
+            deadline += period;
+            fraction += 1000000UL % fps;
+            if(fraction >= fps) {
+                fraction -= fps;
+                ++deadline;
+            }
+
+            // A window runs from the frame opening it to the one closing it, and only
+            // the latter is counted in it.
+            if(first) {
+                return;
+            }
+            ++window_frames;
+            if(due - window_start >= 1000000UL) {
+                last_frames = window_frames;
+                last_window = due - window_start;
+                window_frames = 0;
+                window_start = due;
+            }
+        }
+
+        /**
+         * Get the time left until the current deadline.
+         *
+         * @returns The remaining time in microseconds, or 0 if the deadline has passed.
+         */
+        uint32_t remaining() const {
+            const int32_t remaining = (int32_t) (deadline - now());
+            return remaining > 0 ? remaining : 0;
+        }
+
+        /**
+         * Halt execution until the current deadline. If it has already passed this
+         * counts an overrun and applies the overrun policy instead.
+         */
+        void sleep() {
+            if(!started) {
+                return;
+            }
+
+            const int32_t remaining = (int32_t) (deadline - now());
+
+            if(remaining < 0) {
+                ++overrun_count;
+                if((policy == OVERRUN_SKIP) || ((uint32_t) -remaining > max_lag * period)) {
+                    deadline -= remaining;  // Restart the schedule from now.
+                }
+                return;
+            }
+
+            delay(remaining / 1000);
+            delayMicroseconds(remaining % 1000);
+        }
+
+        /**
+         * Move on to the next frame deadline and wait for it.
+         *
+         * @param fps The desired frame rate.
+         */
+        void wait(uint8_t fps) {
+            next(fps);
+            sleep();
+        }
+
+        /**
+         * Choose what to do when frames are late.
+         *
+         * @param policy The policy to be used from now on.
+         */
+        void set_overrun(Overrun policy) {
+            this -> policy = policy;
+        }
+
+        /**
+         * Get the frame rate that was actually achieved, measured over the last
+         * complete window of (roughly) one second.
+         *
+         * @returns The frames per second, or 0 if not enough frames have been shown.
+         */
+        float achieved_fps() const {
+            return last_window == 0 ? 0 : last_frames * 1000000.0f / last_window;
+        }
+
+        /**
+         * Get the amount of frames that missed their deadline.
+         *
+         * @returns The overrun counter. Wraps around on overflow.
+         */
+        uint16_t overruns() const {
+            return overrun_count;
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * When the current frame is due, in microseconds.
+         */
+        uint32_t deadline = 0;
+
+        /**
+         * Time between frames, in microseconds.
+         */
+        uint32_t period = 0;
+
+        /**
+         * Fractions of a microsecond carried over, in units of 1/fps.
+         */
+        uint16_t fraction = 0;
+
+        /**
+         * Whether the first deadline was set.
+         */
+        bool started = false;
+
+        /**
+         * What to do on overruns.
+         */
+        Overrun policy = OVERRUN_SKIP;
+
+        /**
+         * Amount of frames that missed their deadline.
+         */
+        uint16_t overrun_count = 0;
+
+        /**
+         * Time missed by micros(), in microseconds.
+         */
+        static uint32_t lost;
+
+        /**
+         * Frame rate measurement. Frames shown since, and start of, the current window.
+         */
+        uint16_t window_frames = 0;
+        uint32_t window_start = 0;
+
+        /**
+         * Frame rate measurement. Frames shown in, and duration of, the last complete
+         * window.
+         */
+        uint16_t last_frames = 0;
+        uint32_t last_window = 0;
+};
+
+// Allocate the clock correction.
+uint32_t Scheduler::lost = 0;
+
+#endif  // SCHEDULER_H_
@@ -20,86 +20,198 @@ class Stars : public Effect {
     public:  ///////////////////////////////////////////////////////////////////////
 
         /**
-         * Destructor. Free up resources.
+         * The frame rate the effect is meant to run at.
          */
-        ~Stars() {
-            delete callback;
-        }
+        static const uint8_t fps = 60;
 
         /**
-         * Update the contents of the LED matrix.
+         * Update the contents of the LED matrix. Only the stars are written, unless the
+         * frame buffer holds something else.
          */
         void update() {
-            fill(callback);
-            show(60);  // Show changes and keep the code to ~60 FPS.
-            callback -> update();
+            if(owns()) {
+                for(uint8_t k = 0; k < callback.size(); ++k) {
+                    const Star &star = callback[k];
+                    set_led(star.i, star.j, star.colour());
+                }
+            } else {
+                fill(&callback);
+            }
+            present(fps);  // Show changes and keep the code to ~60 FPS.
+            if(due()) {
+                callback.update();
+            }
         }
 
     private:  //////////////////////////////////////////////////////////////////////
 
         /**
-         * Effect callback that will compute and show the starry effect.
+         * A single star.
+         */
+        struct Star {
+
+            /**
+             * Position of the star.
+             */
+            Coord i, j;
+
+            /**
+             * How bright the star is.
+             */
+            uint8_t level;
+
+            /**
+             * Twinkling. Where the star is in its cycle, and how fast it goes through it.
+             */
+            uint8_t phase, speed;
+
+            /**
+             * Get the colour of the star, dimmed by up to a quarter as it twinkles.
+             */
+            CRGB colour() const {
+                const uint8_t wave = phase < 0x80 ? phase : 0xFF - phase;
+                const uint8_t shown = scale8(level, 0xC0 + (wave >> 1));
+                return CRGB(shown, shown, shown);
+            }
+        };
+
+        /**
+         * Effect callback that will compute and show the starry effect. Stars are kept
+         * in a pool sorted in storage order, and only the live ones are worked on.
          */
-        class Callback : public FillCallback {
+        class Callback : public LinearFillCallback<Callback> {
 
             public:
 
                 /**
-                 * Callback function. Shows the starry animation.
+                 * The maximum amount of stars shown at once. With a star spawned every 4
+                 * frames on average, each lasting ~100 frames, about 25 are lit at once,
+                 * and a spawn finds the pool full well under once in a thousand.
+                 */
+                static const uint8_t capacity = 40;
+
+                /**
+                 * How much stars dim on each frame.
+                 */
+                static const uint8_t decay = 2;
+
+                /**
+                 * Callback function. Shows the starry animation. The LEDs have to be
+                 * asked for in storage order, as fill() does.
                  *
+                 * @param n The linear index of the pixel.
                  * @param i The row index.
                  * @param j The column index.
                  *
-                 * @returns An RGB colour to be set at the given coordinates.
+                 * @returns An RGB colour to be set at the given position.
                  */
-                CRGB call(uint8_t i, uint8_t j) {
-                    return 0x010101 * stars[index(i, j)];
+                CRGB call(Index n, Coord i, Coord j) {
+                    if(n == 0) {
+                        cursor = 0;
+                    }
+                    if((cursor < count) && (stars[cursor].i == i) && (stars[cursor].j == j)) {
+                        return stars[cursor++].colour();
+                    }
+                    return CRGB::Black;
                 }
 
                 /**
                  * Create the next frame of the stars animation.
                  */
                 void update() {
+                    // Forget the stars that went dark, now that they were shown as such,
+                    // and fade the rest.
+                    uint8_t live = 0;
+                    for(uint8_t k = 0; k < count; ++k) {
+                        Star &star = stars[k];
+                        if(star.level == 0) {
+                            continue;
+                        }
+                        star.level = qsub8(star.level, decay);
+                        star.phase += star.speed;
+                        stars[live++] = star;
+                    }
+                    count = live;
+
                     //  Generate random spots.
                     if(random8(0x04) == 0) {
-                        stars[index(random8(rows), random8(cols))] = random8(0xA0, 0xFF);
+                        spawn(random_coord(rows), random_coord(cols));
                     }
+                }
 
-                    // Fade.
-                    for(uint8_t i = 0; i < rows; ++i) {
-                        for(uint8_t j = 0; j < cols; ++j) {
-                            stars[index(i, j)] = qsub8(stars[index(i, j)], 0x02);
-                        }
-                    }
+                /**
+                 * Get the amount of stars in the pool, including the ones that just went
+                 * dark.
+                 */
+                uint8_t size() const {
+                    return count;
+                }
+
+                /**
+                 * Get a star from the pool.
+                 *
+                 * @param k The position of the star in the pool.
+                 */
+                const Star &operator[](uint8_t k) const {
+                    return stars[k];
                 }
 
             private:
 
                 /**
-                 * An array with the info to be shown. Contents define the intensity of each
-                 * pixel.
+                 * The stars, sorted in storage order (see index()).
                  */
-                uint8_t stars[num_leds] = { };
+                Star stars[capacity];
 
                 /**
-                 * Compute the linear coordinate of a star in the array based on its real
-                 * position.
-                 *
-                 * @param i The row coordinate of the pixel.
-                 * @param j The column coordinate of the pixel.
+                 * The amount of stars in the pool, and the next one to be looked at by
+                 * call().
+                 */
+                uint8_t count = 0, cursor = 0;
+
+                /**
+                 * Light up a star, unless the pool is full. A star already there is lit up
+                 * again.
                  *
-                 * @warning This will not validate the inputs, and using invalid coordinates
-                 *          results in undefined behaviour.
+                 * @param i The row coordinate of the star.
+                 * @param j The column coordinate of the star.
                  */
-                static uint16_t index(uint8_t i, uint8_t j) {
-                    return ((uint16_t) i) + ((uint16_t) j) * ((uint16_t) rows);
+                void spawn(Coord i, Coord j) {
+                    const Index n = index(i, j);
+                    uint8_t k = 0;
+                    while((k < count) && (index(stars[k].i, stars[k].j) < n)) {
+                        ++k;
+                    }
+
+                    if((k == count) || (stars[k].i != i) || (stars[k].j != j)) {
+                        if(count == capacity) {
+                            return;
+                        }
+                        memmove(stars + k + 1, stars + k, (count - k) * sizeof(Star));
+                        ++count;
+                        stars[k].i = i;
+                        stars[k].j = j;
+                    }
+
+                    stars[k].level = random8(0xA0, 0xFF);
+                    stars[k].phase = random8();
+                    stars[k].speed = random8(2, 12);
                 }
         };
 
         /**
-         * The callback instance to be sent to the parent class.
+         * The callback instance to be sent to the parent class. Kept inline, so that
+         * effects never touch the heap.
+         */
+        Callback callback;
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The per pixel part of the effect, so that it can be layered with others (see
+         * compositor.h).
          */
-        Callback * const callback = new Callback();
+        typedef Callback Kernel;
 };
 
 #endif  // STARS_H_
@@ -0,0 +1,279 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Frame timing telemetry, streamed over serial.                                *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <Arduino.h>  // Serial port.
+
+#include "scheduler.h"  // Frame timing clock.
+
+
+/**
+ * Measures how long every frame spends on each of its phases (see Effect::Phase),
+ * timestamping each change of phase with Scheduler::now(). That is micros() made
+ * up for the ticks it misses while sending to the LEDs, without which showing
+ * would look several times cheaper than it is. Every `period` frames it sends the
+ * minimum, average and maximum of each phase, a coarse histogram of how long
+ * frames took to get ready, along with how many frames missed their deadline, the
+ * most power a frame asked for and how many frames had their brightness lowered to
+ * stay within the limit (see PowerMeter), as a single binary record over serial
+ * (see host/telemetry.py).
+ *
+ * A frame goes from one transmission to the next one, so it includes the effect's
+ * work, the fill, the wait and the sending of the previous frame to the LEDs. The
+ * power limiter runs right before sending, so it counts as showing. The histogram
+ * counts frames by the time they were busy, that is all but the wait, in buckets
+ * doubling from 1ms (1.024ms, to be precise): under 1ms, 1-2ms, 2-4ms and so on up
+ * to 64ms or more. The averages hide the odd slow frame, and the maximums don't
+ * tell whether it was one frame or many.
+ *
+ * Records never block: if the serial buffer has no room for a whole record it is
+ * dropped, and the next one says so.
+ *
+ * Record layout, little endian:
+ *
+ *     offset  size  field
+ *          0     2  sync, 0xA5 0x5A
+ *          2     1  version, currently 3
+ *          3     1  payload length, 54
+ *          4     2  frames measured
+ *          6     2  frames that missed their deadline
+ *          8     2  records dropped before this one
+ *         10     4  time covered, in microseconds
+ *         14    24  min, avg and max of each phase (effect, fill, show, wait), in µs
+ *         38     2  most power asked for by a frame, in mW
+ *         40     2  frames that had their brightness lowered
+ *         42    16  frames busy for under 1ms, 1-2ms, ..., 32-64ms, 64ms or more
+ *         58     1  checksum, xor of the payload
+ */
+class Telemetry {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The amount of phases measured, numbered from 1 as in Effect::Phase.
+         */
+        static const uint8_t phases = 4;
+
+        /**
+         * The amount of buckets in the histogram.
+         */
+        static const uint8_t buckets = 8;
+
+        /**
+         * Size of a record, in bytes.
+         */
+        static const uint8_t size = 4 + 38 + 2 * buckets + 1;
+
+        /**
+         * Note that a frame moved to a new phase.
+         *
+         * @param phase The phase starting now, from 1 to `phases`.
+         */
+        static void enter(uint8_t phase) {
+            const uint32_t now = Scheduler::now();
+            if((current > 0) && (current <= phases)) {
+                spent[current - 1] += now - since;
+            }
+            current = phase;
+            since = now;
+        }
+
+        /**
+         * Note that a frame is about to be sent to the LEDs, closing the previous one.
+         *
+         * @param overruns The overrun counter of the scheduler in charge.
+         * @param power The power the frame asks for, in milliwatts.
+         * @param throttled The counter of frames that had their brightness lowered.
+         */
+        static void frame(uint16_t overruns, uint32_t power, uint16_t throttled) {
+            const uint32_t now = Scheduler::now();
+            if(fresh) {
+                // The first frame has no previous one to be measured.
+                fresh = false;
+                started = now;
+            } else {
+                for(uint8_t k = 0; k < phases; ++k) {
+                    const uint16_t taken = spent[k] > 0xFFFF ? 0xFFFF : spent[k];
+                    low[k] = taken < low[k] ? taken : low[k];
+                    high[k] = taken > high[k] ? taken : high[k];
+                    total[k] += taken;
+                }
+                ++histogram[bucket(spent[0] + spent[1] + spent[2])];
+                // Effects (and so schedulers) come and go, restarting their counters.
+                late += overruns >= seen ? overruns - seen : overruns;
+                ++frames;
+            }
+            memset(spent, 0, sizeof(spent));
+            seen = overruns;
+
+            const uint16_t asked = power > 0xFFFF ? 0xFFFF : power;
+            peak = asked > peak ? asked : peak;
+            dimmed += throttled - throttles;  // Never restarts, so it only wraps.
+            throttles = throttled;
+
+            if(frames >= period) {
+                send(now);
+            }
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * How many frames each record covers.
+         */
+        static const uint16_t period = EFFECT_TELEMETRY;
+
+        /**
+         * The phase in progress, and when it started.
+         */
+        static uint8_t current;
+        static uint32_t since;
+
+        /**
+         * Time spent on each phase during the current frame.
+         */
+        static uint32_t spent[phases];
+
+        /**
+         * Statistics for the current record: the shortest, longest and total time spent
+         * on each phase.
+         */
+        static uint16_t low[phases], high[phases];
+        static uint32_t total[phases];
+
+        /**
+         * Frames in the current record by how long they were busy (see bucket()).
+         */
+        static uint16_t histogram[buckets];
+
+        /**
+         * Frames in the current record, and when the first one started.
+         */
+        static uint16_t frames;
+        static uint32_t started;
+
+        /**
+         * Whether no frame was seen yet.
+         */
+        static bool fresh;
+
+        /**
+         * Overruns in the current record, and the last value of the scheduler's counter.
+         */
+        static uint16_t late, seen;
+
+        /**
+         * The most power asked for in the current record, the frames dimmed in it and
+         * the last value of the limiter's counter.
+         */
+        static uint16_t peak, dimmed, throttles;
+
+        /**
+         * Records that didn't fit in the serial buffer.
+         */
+        static uint16_t dropped;
+
+        /**
+         * Send the current record and start the next one.
+         *
+         * @param now The current time.
+         */
+        static void send(uint32_t now) {
+            uint8_t record[size] = { 0xA5, 0x5A, 3, size - 5 };
+            uint8_t *p = record + 4;
+            p = put(p, frames);
+            p = put(p, late);
+            p = put(p, dropped);
+            p = put(p, (uint16_t) (now - started));
+            p = put(p, (uint16_t) ((now - started) >> 16));
+            for(uint8_t k = 0; k < phases; ++k) {
+                p = put(p, low[k]);
+                p = put(p, (uint16_t) (total[k] / frames));
+                p = put(p, high[k]);
+            }
+            p = put(p, peak);
+            p = put(p, dimmed);
+            for(uint8_t k = 0; k < buckets; ++k) {
+                p = put(p, histogram[k]);
+            }
+            uint8_t checksum = 0;
+            for(uint8_t *q = record + 4; q < p; ++q) {
+                checksum ^= *q;
+            }
+            *p = checksum;
+
+            if(Serial.availableForWrite() >= size) {
+                Serial.write(record, size);
+                dropped = 0;
+            } else {
+                ++dropped;
+            }
+
+            for(uint8_t k = 0; k < phases; ++k) {
+                low[k] = 0xFFFF;
+                high[k] = 0;
+                total[k] = 0;
+            }
+            memset(histogram, 0, sizeof(histogram));
+            frames = 0;
+            started = now;
+            late = 0;
+            peak = 0;
+            dimmed = 0;
+        }
+
+        /**
+         * Find the histogram bucket for a frame: 0 if it was busy for under 1024µs, and
+         * one more for each doubling of that, up to the last one.
+         *
+         * @param busy How long the frame was busy, in microseconds.
+         */
+        static uint8_t bucket(uint32_t busy) {
+            uint8_t k = 0;
+            for(busy >>= 10; (busy != 0) && (k < buckets - 1); busy >>= 1) {
+                ++k;
+            }
+            return k;
+        }
+
+        /**
+         * Write a 16 bit value into a record.
+         *
+         * @param p Where to write it.
+         * @param value The value.
+         *
+         * @returns Where to write the next value.
+         */
+        static uint8_t *put(uint8_t *p, uint16_t value) {
+            p[0] = lowByte(value);
+            p[1] = highByte(value);
+            return p + 2;
+        }
+};
+
+// Allocate the telemetry state.
+uint8_t Telemetry::current = 0;
+uint32_t Telemetry::since = 0;
+uint32_t Telemetry::spent[Telemetry::phases];
+uint16_t Telemetry::low[Telemetry::phases] = { 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF };
+uint16_t Telemetry::high[Telemetry::phases];
+uint32_t Telemetry::total[Telemetry::phases];
+uint16_t Telemetry::histogram[Telemetry::buckets];
+uint16_t Telemetry::frames = 0;
+uint32_t Telemetry::started = 0;
+bool Telemetry::fresh = true;
+uint16_t Telemetry::late = 0;
+uint16_t Telemetry::seen = 0;
+uint16_t Telemetry::peak = 0;
+uint16_t Telemetry::dimmed = 0;
+uint16_t Telemetry::throttles = 0;
+uint16_t Telemetry::dropped = 0;
+
+#endif  // TELEMETRY_H_
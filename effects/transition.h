@@ -0,0 +1,188 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Cross-fade from one effect to another.                                       *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef TRANSITION_H_
+#define TRANSITION_H_
+
+#include "effect.h"     // Abstract effect structure.
+#include "scheduler.h"  // Frame rate control.
+
+
+/**
+ * Runs two effects at once for a while, fading from the first one to the second.
+ *
+ * No extra frame buffer is needed: on every frame the outgoing effect fills the
+ * shared buffer as usual, and then the incoming one blends its colours straight into
+ * it, pixel by pixel, as it fills. Neither of them shows its frame or keeps its own
+ * schedule; the transition shows the mix at its own frame rate, at least as high as
+ * either effect's. Each effect only moves on when its own next frame is due, like the
+ * layers of a Compositor, and fills in the same frame again otherwise, so effects
+ * keep their pace through the fade.
+ *
+ * This only works for effects that write every LED on every frame, which is what
+ * all fill() methods do.
+ */
+class Transition {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * Constructor.
+         *
+         * @param duration How long transitions last, in milliseconds.
+         * @param fps The lowest frame rate during transitions.
+         */
+        explicit Transition(uint16_t duration, uint8_t fps = 30) : duration(duration), fps(fps) { }
+
+        /**
+         * Start fading between two effects.
+         *
+         * @param from The effect being shown so far.
+         * @param from_fps The frame rate the outgoing effect is meant to run at.
+         * @param to The effect to be shown from now on.
+         * @param to_fps The frame rate the incoming effect is meant to run at.
+         */
+        void start(Effect *from, uint8_t from_fps, Effect *to, uint8_t to_fps) {
+            this -> from = from;
+            this -> to = to;
+            this -> from_fps = from_fps;
+            this -> to_fps = to_fps;
+            rate = fps > from_fps ? fps : from_fps;
+            rate = rate > to_fps ? rate : to_fps;
+            from_phase = to_phase = 0;
+            scheduler = Scheduler();  // Don't count the time between transitions as late.
+            started = scheduler.now();
+            frames = 0;
+            total = 0;
+            peak = 0;
+        }
+
+        /**
+         * Check whether a transition is in progress.
+         */
+        bool running() const {
+            return to != nullptr;
+        }
+
+        /**
+         * Show the next frame of the transition. Once the incoming effect is fully faded
+         * in the transition is over, and the outgoing effect can be let go.
+         */
+        void update() {
+            const uint32_t begin = scheduler.now();
+            const uint32_t elapsed = (begin - started) / 1000;
+            const uint8_t amount = elapsed >= duration ? 0xFF : elapsed * 0xFF / duration;
+
+            Effect::held = true;
+            Effect::paused = !due(from_phase, from_fps);
+            from -> update();
+            Effect::mix = amount > 0 ? amount : 1;
+            Effect::paused = !due(to_phase, to_fps);
+            to -> update();
+            Effect::mix = 0;
+            Effect::paused = false;
+            Effect::held = false;
+
+            const uint32_t cost = scheduler.now() - begin;
+            total += cost;
+            peak = cost > peak ? cost : peak;
+            ++frames;
+
+            EFFECT_PROBE(Effect::PHASE_WAIT);
+            scheduler.sleep();
+            EFFECT_PROBE(Effect::PHASE_SHOW);
+            Effect::transmit(scheduler);
+            scheduler.next(rate);
+            EFFECT_PROBE(Effect::PHASE_EFFECT);
+
+            if(amount == 0xFF) {
+                from = to = nullptr;
+            }
+        }
+
+        /**
+         * Get the average time it took to compute a frame of the last transition, not
+         * counting the time spent sending it to the LEDs.
+         *
+         * @returns The average cost, in microseconds.
+         */
+        uint32_t cost() const {
+            return frames == 0 ? 0 : total / frames;
+        }
+
+        /**
+         * Get the longest time it took to compute a frame of the last transition.
+         *
+         * @returns The highest cost, in microseconds.
+         */
+        uint32_t peak_cost() const {
+            return peak;
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Check whether an effect's next frame is due on this frame of the transition,
+         * moving it on by a transition frame.
+         *
+         * @param phase How far the effect is into its next frame.
+         * @param effect_fps The frame rate the effect is meant to run at.
+         */
+        bool due(uint16_t &phase, uint8_t effect_fps) const {
+            phase += effect_fps;
+            if(phase < rate) {
+                return false;
+            }
+            phase -= rate;
+            return true;
+        }
+
+        /**
+         * How long transitions last, in milliseconds.
+         */
+        const uint16_t duration;
+
+        /**
+         * The lowest frame rate during transitions.
+         */
+        const uint8_t fps;
+
+        /**
+         * The frame rate of the current transition, and those of the effects in it.
+         */
+        uint8_t rate = 0, from_fps = 0, to_fps = 0;
+
+        /**
+         * How far each effect is into its next frame, in units of 1/rate frames.
+         */
+        uint16_t from_phase = 0, to_phase = 0;
+
+        /**
+         * The effects being faded out and in, or null if there's no transition going on.
+         */
+        Effect *from = nullptr, *to = nullptr;
+
+        /**
+         * Keeps the frame rate steady during transitions.
+         */
+        Scheduler scheduler;
+
+        /**
+         * When the current transition started, in microseconds.
+         */
+        uint32_t started = 0;
+
+        /**
+         * Cost measurement. Frames shown, and total and highest time spent computing them,
+         * in microseconds.
+         */
+        uint16_t frames = 0;
+        uint32_t total = 0, peak = 0;
+};
+
+#endif  // TRANSITION_H_
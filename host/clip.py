@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+################################################################################
+# Turns pre-rendered frames into a clip the lamp can play from flash.          #
+#                                                                              #
+# Frames are read as raw RGB, as written by `render -f raw`, and written as a  #
+# header for the clip effect (see effects/clip.h): a palette of at most 256    #
+# colours, and every frame as the operations that turn the previous one into   #
+# it. Frames with more colours than that are approximated.                     #
+#                                                                              #
+# Author:   Kip (https://github.com/kip93/).                                   #
+# Source:   https://github.com/kip93/lamp/                                     #
+# License:  BSD 3-Clause                                                       #
+################################################################################
+
+import argparse
+import collections
+import sys
+
+from stream import storage_order
+
+MAX_COLOURS = 256
+MAX_COUNT = 64
+
+# Operations, as in Clip::Op.
+SKIP, RUN, LITERAL, END = 0, 1, 2, 3
+
+
+def op(kind, count=1):
+    """The first byte of an operation."""
+    return bytes([(kind << 6) | (count - 1)])
+
+
+def make_palette(frames):
+    """Pick the colours of the clip, and map every colour in it to one of them."""
+    counts = collections.Counter(colour for leds in frames for colour in leds)
+    palette = sorted(colour for colour, _ in counts.most_common(MAX_COLOURS))
+    index = {colour: k for k, colour in enumerate(palette)}
+    for colour in counts:
+        if colour not in index:
+            index[colour] = min(range(len(palette)), key=lambda k: sum(
+                (a - b) ** 2 for a, b in zip(colour, palette[k])))
+    return palette, index
+
+
+def encode(frame, previous):
+    """Encode a frame (a list of palette indices) over the previous one, if any."""
+    out = bytearray()
+    n = 0
+    while n < len(frame):
+        if previous is not None and frame[n] == previous[n]:
+            if all(a == b for a, b in zip(frame[n:], previous[n:])):
+                out += op(END)
+                break
+            count = 1
+            while (n + count < len(frame) and count < MAX_COUNT and
+                   frame[n + count] == previous[n + count]):
+                count += 1
+            out += op(SKIP, count)
+            n += count
+            continue
+
+        count = 1
+        while n + count < len(frame) and count < MAX_COUNT and frame[n + count] == frame[n]:
+            count += 1
+        if count >= 2:
+            out += op(RUN, count) + bytes([frame[n]])
+            n += count
+            continue
+
+        # Literals, until something cheaper comes up: LEDs that stay the same, or runs.
+        count = 1
+        while n + count < len(frame) and count < MAX_COUNT:
+            k = n + count
+            if previous is not None and frame[k] == previous[k]:
+                break
+            if k + 2 < len(frame) and frame[k] == frame[k + 1] == frame[k + 2]:
+                break
+            count += 1
+        out += op(LITERAL, count) + bytes(frame[n:n + count])
+        n += count
+    return bytes(out)
+
+
+def array(name, data, width=16):
+    """Write the definition of an array in PROGMEM."""
+    lines = ['const uint8_t %s[] PROGMEM = {' % name]
+    for k in range(0, len(data), width):
+        lines.append('    ' + ', '.join('0x%02X' % byte for byte in data[k:k + width]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Make a clip for the lamp out of frames.')
+    parser.add_argument('frames', help='raw RGB frames, as written by render -f raw (- for stdin)')
+    parser.add_argument('name', help='name of the clip, e.g. fire for FireClip')
+    parser.add_argument('-o', '--output', help='header to write (default: stdout)')
+    parser.add_argument('-f', '--fps', type=int, default=60, help='frame rate of the frames')
+    parser.add_argument('-s', '--skip', type=int, default=0, help='frames to skip at the start')
+    parser.add_argument('-n', '--count', type=int, help='frames to keep (default: all)')
+    parser.add_argument('-r', '--rows', type=int, default=16, help='rows of the matrix')
+    parser.add_argument('-c', '--cols', type=int, default=14, help='columns of the matrix')
+    args = parser.parse_args()
+
+    size = args.rows * args.cols * 3
+    source = sys.stdin.buffer if args.frames == '-' else open(args.frames, 'rb')
+    frames = []
+    while args.count is None or len(frames) < args.skip + args.count:
+        image = source.read(size)
+        if len(image) < size:
+            break
+        frames.append(storage_order(image, args.rows, args.cols))
+    frames = frames[args.skip:]
+    if not frames:
+        sys.exit('No frames to make a clip out of')
+    if not 0 < args.fps < 256:
+        sys.exit('The frame rate must be between 1 and 255')
+
+    palette, index = make_palette(frames)
+    data = bytearray()
+    previous = None
+    for leds in frames:
+        frame = [index[colour] for colour in leds]
+        data += encode(frame, previous)
+        previous = frame
+
+    error = max(abs(a - b) for leds in frames for colour in leds
+                for a, b in zip(colour, palette[index[colour]]))
+    print('%d frames, %d colours (error up to %d), %d bytes of data, %d of palette'
+          % (len(frames), len(palette), error, len(data), 3 * len(palette)), file=sys.stderr)
+
+    name = args.name[:1].upper() + args.name[1:] + 'Clip'
+    guard = 'CLIPS_' + args.name.upper() + '_H_'
+    header = '\n'.join([
+        '/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \\',
+        '* %-76s *' % ('Clip made by host/clip.py. Do not edit.'),
+        '*                                                                              *',
+        '* Author:   Kip (https://github.com/kip93/).                                   *',
+        '* Source:   https://github.com/kip93/lamp/                                     *',
+        '* License:  BSD 3-Clause                                                       *',
+        '\\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */',
+        '',
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '#include <avr/pgmspace.h>  // Allow access to PROGMEM.',
+        '',
+        '',
+        'struct %s {' % name,
+        '    static const uint8_t fps = %d;' % args.fps,
+        '    static const uint16_t leds = %d;' % (args.rows * args.cols),
+        '    static const uint16_t frames = %d;' % len(frames),
+        '    static const uint8_t palette[%d];' % (3 * len(palette)),
+        '    static const uint8_t data[%d];' % len(data),
+        '};',
+        '',
+        array('%s::palette' % name, b''.join(palette)),
+        '',
+        array('%s::data' % name, data),
+        '',
+        '#endif  // %s' % guard,
+        '',
+    ])
+
+    if args.output:
+        with open(args.output, 'w') as out:
+            out.write(header)
+    else:
+        sys.stdout.write(header)
+
+
+if __name__ == '__main__':
+    main()
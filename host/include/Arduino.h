@@ -0,0 +1,384 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Host stand-in for the bits of the Arduino core used by the lamp.             *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+
+#include <chrono>   // Wall clock for micros()/millis().
+#include <cstddef>  // size_t.
+#include <cstdint>  // Fixed width integer types.
+#include <cstdio>   // FILE, snprintf().
+#include <cstdlib>  // abs(), rand().
+#include <cstring>  // memset(), memcpy().
+
+#include <sys/ioctl.h>  // FIONREAD.
+#include <unistd.h>     // read(), write().
+
+
+/**
+ * Host only helpers. Nothing in here exists on the board.
+ */
+namespace host {
+
+    /**
+     * The clock used on the host. It is the real time spent since start up plus all
+     * the time that was "slept" through delay(), which is skipped instead of waited
+     * for. This way computation costs are real but idle time is free. Time spent with
+     * interrupts disabled is mostly missed, as it is on the board.
+     */
+    class Clock {
+
+        public:  ///////////////////////////////////////////////////////////////////////
+
+            /**
+             * Get the single clock instance.
+             */
+            static Clock &instance() {
+                static Clock clock;
+                return clock;
+            }
+
+            /**
+             * The current time, in microseconds, as seen by micros().
+             */
+            uint64_t now() const {
+                return real() + slept - missed;
+            }
+
+            /**
+             * The real time spent since start up, not counting sleeps, in nanoseconds.
+             */
+            uint64_t busy() const {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            }
+
+            /**
+             * The total time skipped through sleeps, in microseconds.
+             */
+            uint64_t skipped() const {
+                return slept;
+            }
+
+            /**
+             * Pretend that some time has passed.
+             *
+             * @param us The amount of microseconds to skip.
+             */
+            void sleep(uint64_t us) {
+                slept += us;
+            }
+
+            /**
+             * Pretend that some time has passed with interrupts disabled. Like the board's
+             * timer 0, the clock only catches up on one of the overflows in that time, and
+             * misses the rest.
+             *
+             * @param us The amount of microseconds to skip.
+             */
+            void stall(uint64_t us) {
+                slept += us;
+                missed += us >= 2 * overflow ? (us / overflow - 1) * overflow : 0;
+            }
+
+        private:  //////////////////////////////////////////////////////////////////////
+
+            /**
+             * The moment the clock was first used.
+             */
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            /**
+             * How often timer 0 overflows on a 16MHz board, in microseconds.
+             */
+            static const uint64_t overflow = 1024;
+
+            /**
+             * Accumulated sleep time, and how much of it was missed, in microseconds.
+             */
+            uint64_t slept = 0, missed = 0;
+
+            /**
+             * Real time elapsed since start up, in microseconds.
+             */
+            uint64_t real() const {
+                return std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            }
+    };
+}
+
+// Pin levels and modes. These are macros on the board too.
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+// Pin changes that trigger an interrupt, and the pins that can trigger one (those of
+// an Uno or a Nano).
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+#define NOT_AN_INTERRUPT -1
+#define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : NOT_AN_INTERRUPT))
+
+// Bit helpers. These are macros on the board too, so they clash with any identifier
+// of the same name.
+#define bit(b) (1UL << (b))
+#define lowByte(w) ((uint8_t) ((w) & 0xFF))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+
+/**
+ * Microseconds since start up. Wraps around like the real thing does.
+ */
+inline unsigned long micros() {
+    return (uint32_t) host::Clock::instance().now();
+}
+
+/**
+ * Milliseconds since start up. Wraps around like the real thing does.
+ */
+inline unsigned long millis() {
+    return (uint32_t) (host::Clock::instance().now() / 1000);
+}
+
+/**
+ * Halt for the given amount of milliseconds. On the host this returns immediately.
+ */
+inline void delay(unsigned long ms) {
+    host::Clock::instance().sleep(((uint64_t) ms) * 1000);
+}
+
+/**
+ * Halt for the given amount of microseconds. On the host this returns immediately.
+ */
+inline void delayMicroseconds(unsigned int us) {
+    host::Clock::instance().sleep(us);
+}
+
+namespace host {
+
+    /**
+     * The level of each digital pin, as read by digitalRead(). Host only, so that
+     * e.g. button presses can be simulated.
+     */
+    static uint8_t pins[64];
+
+    /**
+     * The function attached to each external interrupt, if any, and the changes that
+     * trigger it.
+     */
+    static void (*handlers[2])() = { nullptr, nullptr };
+    static int triggers[2] = { 0, 0 };
+}
+
+/**
+ * Disable and enable interrupts. On the host nothing interrupts the sketch, so there's
+ * nothing to do.
+ */
+inline void noInterrupts() { }
+inline void interrupts() { }
+
+/**
+ * Call a function whenever the pin of an external interrupt changes as given.
+ */
+inline void attachInterrupt(int interrupt, void (*handler)(), int mode) {
+    if((interrupt >= 0) && (interrupt < 2)) {
+        host::handlers[interrupt] = handler;
+        host::triggers[interrupt] = mode;
+    }
+}
+
+/**
+ * Set up a pin. Pull-ups make inputs read HIGH until something pulls them down.
+ */
+inline void pinMode(uint8_t pin, uint8_t mode) {
+    host::pins[pin] = mode == INPUT_PULLUP ? HIGH : LOW;
+}
+
+/**
+ * Read a digital pin.
+ */
+inline int digitalRead(uint8_t pin) {
+    return host::pins[pin];
+}
+
+/**
+ * Set a digital pin. On the host this is also how the outside world changes a pin, so
+ * it runs the interrupt attached to the pin, if the change triggers it.
+ */
+inline void digitalWrite(uint8_t pin, uint8_t value) {
+    const uint8_t before = host::pins[pin];
+    host::pins[pin] = value;
+
+    const int interrupt = digitalPinToInterrupt(pin);
+    if((interrupt == NOT_AN_INTERRUPT) || (host::handlers[interrupt] == nullptr) || (value == before)) {
+        return;
+    }
+    const int mode = host::triggers[interrupt];
+    if((mode == CHANGE) || ((mode == FALLING) && (value == LOW)) || ((mode == RISING) && (value == HIGH))) {
+        host::handlers[interrupt]();
+    }
+}
+
+/**
+ * Strings kept in flash on the board. On the host they are plain strings.
+ */
+class __FlashStringHelper;
+#define F(string) (reinterpret_cast<const __FlashStringHelper *>(string))
+
+/**
+ * Stand-in for the serial port. Bytes are exchanged through `Serial.port`, if set,
+ * e.g. a pseudo-terminal, and whatever is sent is also copied to `Serial.out`, if
+ * set. Without a port bytes are received from `Serial.in`, if set, and otherwise
+ * nothing is ever received.
+ */
+class HardwareSerial {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * Where sent bytes go, or null to discard them. Host only.
+         */
+        FILE *out = nullptr;
+
+        /**
+         * File descriptor bytes are received from and sent to, or -1. Host only.
+         */
+        int port = -1;
+
+        /**
+         * File descriptor bytes are received from when there is no port, or -1. Host
+         * only.
+         */
+        int in = -1;
+
+        /**
+         * Open the port. On the host there's nothing to open.
+         */
+        void begin(unsigned long baud) { }
+
+        /**
+         * Amount of bytes received and not read yet.
+         */
+        int available() {
+            int pending = 0;
+            if((source() >= 0) && (ioctl(source(), FIONREAD, &pending) < 0)) {
+                pending = 0;
+            }
+            return pending;
+        }
+
+        /**
+         * Read a received byte.
+         *
+         * @returns The byte, or -1 if there's none.
+         */
+        int read() {
+            uint8_t value;
+            return (source() >= 0) && (::read(source(), &value, 1) == 1) ? value : -1;
+        }
+
+        /**
+         * Room left in the transmit buffer. On the host writes never have to wait.
+         */
+        int availableForWrite() {
+            return 64;
+        }
+
+        /**
+         * Send some bytes.
+         *
+         * @returns The amount of bytes sent.
+         */
+        size_t write(uint8_t value) {
+            return write(&value, 1);
+        }
+
+        size_t write(const uint8_t *data, size_t size) {
+            if(out != nullptr) {
+                fwrite(data, 1, size, out);
+            }
+            if((port >= 0) && (::write(port, data, size) < 0)) {
+                return 0;
+            }
+            return size;
+        }
+
+        /**
+         * Send some text, or a number in decimal. Strings from F() can be sent too.
+         *
+         * @returns The amount of bytes sent.
+         */
+        size_t print(const char *text) {
+            return write((const uint8_t *) text, strlen(text));
+        }
+
+        size_t print(const __FlashStringHelper *text) {
+            return print(reinterpret_cast<const char *>(text));
+        }
+
+        size_t print(char value) {
+            return write((uint8_t) value);
+        }
+
+        size_t print(unsigned char value) {
+            return print((unsigned long) value);
+        }
+
+        size_t print(int value) {
+            return print((long) value);
+        }
+
+        size_t print(unsigned int value) {
+            return print((unsigned long) value);
+        }
+
+        size_t print(long value) {
+            char text[24];
+            snprintf(text, sizeof(text), "%ld", value);
+            return print(text);
+        }
+
+        size_t print(unsigned long value) {
+            char text[24];
+            snprintf(text, sizeof(text), "%lu", value);
+            return print(text);
+        }
+
+        /**
+         * Same as print(), followed by a line break.
+         *
+         * @returns The amount of bytes sent.
+         */
+        template<class T> size_t println(T value) {
+            const size_t sent = print(value);
+            return sent + println();
+        }
+
+        size_t println() {
+            return print("\r\n");
+        }
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Where bytes are received from.
+         */
+        int source() const {
+            return port >= 0 ? port : in;
+        }
+};
+
+/**
+ * The serial port. The host build is a single translation unit, so this can live here.
+ */
+static HardwareSerial Serial;
+
+#endif  // HOST_ARDUINO_H_
@@ -0,0 +1,689 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Host stand-in for the parts of the FastLED library used by the lamp.         *
+*                                                                              *
+* The maths mirror the real library (same rounding, same PRNG), so the frames  *
+* produced on the host match the ones the board would compute.                 *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef HOST_FASTLED_H_
+#define HOST_FASTLED_H_
+
+#include <vector>  // Data sent to the LEDs.
+
+#include <Arduino.h>          // Timing functions.
+#include <avr/pgmspace.h>     // PROGMEM access.
+
+
+//////////////////////////////////////////////////////////////////////////////////
+// 8-bit maths.                                                                 //
+//////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Add two numbers, saturating at 0xFF.
+ */
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned int t = i + j;
+    return t > 0xFF ? 0xFF : t;
+}
+
+/**
+ * Subtract two numbers, saturating at 0x00.
+ */
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    int t = i - j;
+    return t < 0 ? 0 : t;
+}
+
+/**
+ * Scale a number by a fraction of 256 (as in FASTLED_SCALE8_FIXED).
+ */
+inline uint8_t scale8(uint8_t i, uint8_t scale) {
+    return (((uint16_t) i) * (1 + (uint16_t) scale)) >> 8;
+}
+
+/**
+ * Scale a number by a fraction of 256, never letting a non zero value become zero.
+ */
+inline uint8_t scale8_video(uint8_t i, uint8_t scale) {
+    return (((int) i * (int) scale) >> 8) + ((i && scale) ? 1 : 0);
+}
+
+/**
+ * Blend two numbers. amount_of_b is the weight of the second one, out of 256.
+ */
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amount_of_b) {
+    uint16_t partial = (a << 8) | b;
+    partial += b * amount_of_b;
+    partial -= a * amount_of_b;
+    return partial >> 8;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Random numbers.                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The shared PRNG state, seeded like the real library.
+ */
+inline uint16_t &rand16seed() {
+    static uint16_t seed = 1337;
+    return seed;
+}
+
+inline void random16_set_seed(uint16_t seed) {
+    rand16seed() = seed;
+}
+
+inline uint16_t random16_get_seed() {
+    return rand16seed();
+}
+
+inline uint8_t random8() {
+    rand16seed() = (rand16seed() * 2053) + 13849;
+    return (uint8_t) (((uint8_t) (rand16seed() & 0xFF)) + ((uint8_t) (rand16seed() >> 8)));
+}
+
+inline uint8_t random8(uint8_t lim) {
+    return (((uint16_t) random8()) * lim) >> 8;
+}
+
+inline uint8_t random8(uint8_t min, uint8_t lim) {
+    return random8(lim - min) + min;
+}
+
+inline uint16_t random16() {
+    rand16seed() = (rand16seed() * 2053) + 13849;
+    return rand16seed();
+}
+
+inline uint16_t random16(uint16_t lim) {
+    return (((uint32_t) random16()) * lim) >> 16;
+}
+
+inline uint16_t random16(uint16_t min, uint16_t lim) {
+    return random16(lim - min) + min;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Trigonometry.                                                                //
+//////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Sine of an angle, 65536 being a full turn, as a fraction of 32767. Piecewise
+ * linear, like the real library's sin16_C().
+ */
+inline int16_t sin16(uint16_t theta) {
+    static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+    static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+
+    uint16_t offset = (theta & 0x3FFF) >> 3;  // 0..2047
+    if(theta & 0x4000) {
+        offset = 2047 - offset;
+    }
+
+    const uint8_t section = offset / 256;  // 0..7
+    const uint8_t secoffset8 = (uint8_t) offset / 2;
+    int16_t y = slope[section] * secoffset8 + base[section];
+    if(theta & 0x8000) {
+        y = -y;
+    }
+    return y;
+}
+
+/**
+ * Cosine of an angle, 65536 being a full turn, as a fraction of 32767.
+ */
+inline int16_t cos16(uint16_t theta) {
+    return sin16(theta + 16384);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Noise.                                                                       //
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace host {
+
+    /**
+     * Ken Perlin's permutation table, with the first entry repeated at the end.
+     */
+    static const uint8_t noise_permutation[257] = {
+        151, 160, 137,  91,  90,  15, 131,  13, 201,  95,  96,  53, 194, 233,   7, 225,
+        140,  36, 103,  30,  69, 142,   8,  99,  37, 240,  21,  10,  23, 190,   6, 148,
+        247, 120, 234,  75,   0,  26, 197,  62,  94, 252, 219, 203, 117,  35,  11,  32,
+         57, 177,  33,  88, 237, 149,  56,  87, 174,  20, 125, 136, 171, 168,  68, 175,
+         74, 165,  71, 134, 139,  48,  27, 166,  77, 146, 158, 231,  83, 111, 229, 122,
+         60, 211, 133, 230, 220, 105,  92,  41,  55,  46, 245,  40, 244, 102, 143,  54,
+         65,  25,  63, 161,   1, 216,  80,  73, 209,  76, 132, 187, 208,  89,  18, 169,
+        200, 196, 135, 130, 116, 188, 159,  86, 164, 100, 109, 198, 173, 186,   3,  64,
+         52, 217, 226, 250, 124, 123,   5, 202,  38, 147, 118, 126, 255,  82,  85, 212,
+        207, 206,  59, 227,  47,  16,  58,  17, 182, 189,  28,  42, 223, 183, 170, 213,
+        119, 248, 152,   2,  44, 154, 163,  70, 221, 153, 101, 155, 167,  43, 172,   9,
+        129,  22,  39, 253,  19,  98, 108, 110,  79, 113, 224, 232, 178, 185, 112, 104,
+        218, 246,  97, 228, 251,  34, 242, 193, 238, 210, 144,  12, 191, 179, 162, 241,
+         81,  51, 145, 235, 249,  14, 239, 107,  49, 192, 214,  31, 181, 199, 106, 157,
+        184,  84, 204, 176, 115, 121,  50,  45, 127,   4, 150, 254, 138, 236, 205,  93,
+        222, 114,  67,  29,  24,  72, 243, 141, 128, 195,  78,  66, 215,  61, 156, 180,
+        151,
+    };
+
+    inline int8_t avg7(int8_t i, int8_t j) {
+        return (i >> 1) + (j >> 1) + (i & 0x1);
+    }
+
+    inline uint8_t ease8InOutQuad(uint8_t i) {
+        uint8_t j = i;
+        if(j & 0x80) {
+            j = 255 - j;
+        }
+        uint8_t jj2 = scale8(j, j) << 1;
+        if(i & 0x80) {
+            jj2 = 255 - jj2;
+        }
+        return jj2;
+    }
+
+    inline int8_t lerp7by8(int8_t a, int8_t b, uint8_t frac) {
+        if(b > a) {
+            return a + scale8(b - a, frac);
+        }
+        return a - scale8(a - b, frac);
+    }
+
+    inline int8_t grad8(uint8_t hash, int8_t x, int8_t y, int8_t z) {
+        hash &= 0xF;
+        int8_t u = (hash & 8) ? y : x;
+        int8_t v = hash < 4 ? y : (hash == 12 || hash == 14) ? x : z;
+        if(hash & 1) {
+            u = -u;
+        }
+        if(hash & 2) {
+            v = -v;
+        }
+        return avg7(u, v);
+    }
+
+    inline int8_t inoise8_raw(uint16_t x, uint16_t y, uint16_t z) {
+        const uint8_t *p = noise_permutation;
+
+        // The unit cube containing the point, and its corners hashed.
+        const uint8_t X = x >> 8, Y = y >> 8, Z = z >> 8;
+        const uint8_t A = p[X] + Y, AA = p[A] + Z, AB = p[(uint8_t) (A + 1)] + Z;
+        const uint8_t B = p[(uint8_t) (X + 1)] + Y, BA = p[B] + Z, BB = p[(uint8_t) (B + 1)] + Z;
+
+        // The position of the point in the cube, signed for grad8() and eased.
+        const int8_t xx = ((uint8_t) x >> 1) & 0x7F;
+        const int8_t yy = ((uint8_t) y >> 1) & 0x7F;
+        const int8_t zz = ((uint8_t) z >> 1) & 0x7F;
+        const uint8_t N = 0x80;
+        const uint8_t u = ease8InOutQuad(x), v = ease8InOutQuad(y), w = ease8InOutQuad(z);
+
+        const int8_t X1 = lerp7by8(grad8(p[AA], xx, yy, zz), grad8(p[BA], xx - N, yy, zz), u);
+        const int8_t X2 = lerp7by8(grad8(p[AB], xx, yy - N, zz), grad8(p[BB], xx - N, yy - N, zz), u);
+        const int8_t X3 = lerp7by8(grad8(p[(uint8_t) (AA + 1)], xx, yy, zz - N),
+                                   grad8(p[(uint8_t) (BA + 1)], xx - N, yy, zz - N), u);
+        const int8_t X4 = lerp7by8(grad8(p[(uint8_t) (AB + 1)], xx, yy - N, zz - N),
+                                   grad8(p[(uint8_t) (BB + 1)], xx - N, yy - N, zz - N), u);
+
+        return lerp7by8(lerp7by8(X1, X2, v), lerp7by8(X3, X4, v), w);
+    }
+}
+
+/**
+ * 3D Perlin noise, with 256 units to a cell of the lattice. Repeats every 65536
+ * units along every axis.
+ */
+inline uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z) {
+    const int8_t n = host::inoise8_raw(x, y, z) + 64;  // 0..128
+    return qadd8(n, n);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Colours.                                                                     //
+//////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * An RGB pixel, laid out in memory exactly like the real one (3 bytes).
+ */
+struct CRGB {
+    union {
+        struct {
+            union { uint8_t r; uint8_t red; };
+            union { uint8_t g; uint8_t green; };
+            union { uint8_t b; uint8_t blue; };
+        };
+        uint8_t raw[3];
+    };
+
+    CRGB() = default;
+
+    constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) { }
+
+    constexpr CRGB(uint32_t colourcode) :
+        r((colourcode >> 16) & 0xFF), g((colourcode >> 8) & 0xFF), b(colourcode & 0xFF) { }
+
+    CRGB &operator=(uint32_t colourcode) {
+        r = (colourcode >> 16) & 0xFF;
+        g = (colourcode >> 8) & 0xFF;
+        b = colourcode & 0xFF;
+        return *this;
+    }
+
+    uint8_t &operator[](uint8_t x) {
+        return raw[x];
+    }
+
+    const uint8_t &operator[](uint8_t x) const {
+        return raw[x];
+    }
+
+    CRGB &operator+=(const CRGB &rhs) {
+        r = qadd8(r, rhs.r);
+        g = qadd8(g, rhs.g);
+        b = qadd8(b, rhs.b);
+        return *this;
+    }
+
+    CRGB &nscale8(uint8_t scale) {
+        r = scale8(r, scale);
+        g = scale8(g, scale);
+        b = scale8(b, scale);
+        return *this;
+    }
+
+    explicit operator bool() const {
+        return r || g || b;
+    }
+
+    /**
+     * Some of the predefined colours.
+     */
+    enum HTMLColorCode {
+        Black = 0x000000,
+        White = 0xFFFFFF,
+        Red   = 0xFF0000,
+        Green = 0x008000,
+        Blue  = 0x0000FF,
+    };
+};
+
+inline bool operator==(const CRGB &lhs, const CRGB &rhs) {
+    return (lhs.r == rhs.r) && (lhs.g == rhs.g) && (lhs.b == rhs.b);
+}
+
+inline bool operator!=(const CRGB &lhs, const CRGB &rhs) {
+    return !(lhs == rhs);
+}
+
+/**
+ * Set a whole array of LEDs to a single colour.
+ */
+inline void fill_solid(CRGB *leds, int count, const CRGB &colour) {
+    for(int i = 0; i < count; ++i) {
+        leds[i] = colour;
+    }
+}
+
+/**
+ * Blend a colour into another one, in place.
+ *
+ * @param existing The colour to be changed.
+ * @param overlay The colour to blend in.
+ * @param amount How much of the overlay to take, out of 256.
+ */
+inline CRGB &nblend(CRGB &existing, const CRGB &overlay, uint8_t amount) {
+    if(amount == 0) {
+        return existing;
+    }
+    if(amount == 0xFF) {
+        existing = overlay;
+        return existing;
+    }
+
+    existing.r = blend8(existing.r, overlay.r, amount);
+    existing.g = blend8(existing.g, overlay.g, amount);
+    existing.b = blend8(existing.b, overlay.b, amount);
+    return existing;
+}
+
+/**
+ * Colour corrections, as RGB scale factors.
+ */
+enum LEDColorCorrection {
+    TypicalLEDStrip = 0xFFB0F0,
+    UncorrectedColor = 0xFFFFFF,
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+// Palettes.                                                                    //
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef uint32_t TProgmemRGBPalette16[16];
+typedef TProgmemRGBPalette16 TProgmemPalette16;
+
+enum TBlendType {
+    NOBLEND = 0,
+    LINEARBLEND = 1,
+};
+
+/**
+ * A 16 colour palette held in RAM.
+ */
+class CRGBPalette16 {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        CRGBPalette16() = default;
+
+        CRGBPalette16(const TProgmemRGBPalette16 &rhs) {
+            for(uint8_t i = 0; i < 16; ++i) {
+                entries[i] = pgm_read_dword(rhs + i);
+            }
+        }
+
+        CRGB &operator[](uint8_t x) {
+            return entries[x];
+        }
+
+        const CRGB &operator[](uint8_t x) const {
+            return entries[x];
+        }
+
+        CRGB entries[16];
+};
+
+/**
+ * Get a colour from a 16 colour palette, optionally blending between entries.
+ */
+inline CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness = 0xFF,
+                             TBlendType blendType = LINEARBLEND) {
+    uint8_t hi4 = index >> 4;
+    uint8_t lo4 = index & 0x0F;
+
+    const CRGB *entry = &(pal[0]) + hi4;
+    uint8_t red1 = entry -> red;
+    uint8_t green1 = entry -> green;
+    uint8_t blue1 = entry -> blue;
+
+    if(lo4 && (blendType != NOBLEND)) {
+        entry = (hi4 == 15) ? &(pal[0]) : entry + 1;
+
+        uint8_t f2 = lo4 << 4;
+        uint8_t f1 = 0xFF - f2;
+
+        red1 = scale8(red1, f1) + scale8(entry -> red, f2);
+        green1 = scale8(green1, f1) + scale8(entry -> green, f2);
+        blue1 = scale8(blue1, f1) + scale8(entry -> blue, f2);
+    }
+
+    if(brightness != 0xFF) {
+        if(brightness) {
+            ++brightness;  // Adjust for rounding.
+            red1 = red1 ? scale8(red1, brightness) : 0;
+            green1 = green1 ? scale8(green1, brightness) : 0;
+            blue1 = blue1 ? scale8(blue1, brightness) : 0;
+        } else {
+            red1 = green1 = blue1 = 0;
+        }
+    }
+
+    return CRGB(red1, green1, blue1);
+}
+
+const TProgmemRGBPalette16 RainbowColors_p PROGMEM = {
+    0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00,
+    0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+    0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5,
+    0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B,
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+// Controllers.                                                                 //
+//////////////////////////////////////////////////////////////////////////////////
+
+enum EOrder {
+    RGB = 0012,
+    RBG = 0021,
+    GRB = 0102,
+    GBR = 0120,
+    BRG = 0201,
+    BGR = 0210,
+};
+
+/**
+ * Chipset tags. They only carry their name on the host.
+ */
+template<uint8_t DATA_PIN, EOrder RGB_ORDER> class WS2812 { };
+template<uint8_t DATA_PIN, EOrder RGB_ORDER> class WS2812B { };
+template<uint8_t DATA_PIN, EOrder RGB_ORDER> class NEOPIXEL { };
+
+/**
+ * A registered strip of LEDs.
+ */
+class CLEDController {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        CLEDController &setCorrection(LEDColorCorrection correction) {
+            this -> correction = CRGB((uint32_t) correction);
+            return *this;
+        }
+
+        CLEDController &setCorrection(CRGB correction) {
+            this -> correction = correction;
+            return *this;
+        }
+
+        CLEDController &setLeds(CRGB *data, int count) {
+            this -> data = data;
+            this -> count = count;
+            return *this;
+        }
+
+        CRGB *leds() const {
+            return data;
+        }
+
+        int size() const {
+            return count;
+        }
+
+        uint8_t pin() const {
+            return data_pin;
+        }
+
+        /**
+         * Host only. Amount of times the strip was sent.
+         */
+        uint32_t shows = 0;
+
+        /**
+         * Host only. The colours last sent, after scaling.
+         */
+        std::vector<CRGB> sent;
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        friend class CFastLED;
+
+        CRGB *data = nullptr;
+        int count = 0;
+        uint8_t data_pin = 0;
+        CRGB correction = CRGB(0xFFFFFF);
+
+        /**
+         * Scale the colours like the real library does while sending them: by the
+         * brightness and the colour correction of the strip. The real library dithers
+         * too, but only at over 100 frames per second, which the lamp never reaches.
+         */
+        void send(uint8_t brightness) {
+            uint8_t adjustment[3];
+            for(uint8_t c = 0; c < 3; ++c) {
+                const uint32_t work = (correction.raw[c] + 1UL) * 0x100 * brightness;
+                adjustment[c] = brightness > 0 && correction.raw[c] > 0 ? (work / 0x10000) & 0xFF : 0;
+            }
+
+            sent.resize(count);
+            for(int n = 0; n < count; ++n) {
+                for(uint8_t c = 0; c < 3; ++c) {
+                    sent[n].raw[c] = scale8(data[n].raw[c], adjustment[c]);
+                }
+            }
+        }
+};
+
+/**
+ * The global FastLED object.
+ */
+class CFastLED {
+
+    public:  ///////////////////////////////////////////////////////////////////////
+
+        /**
+         * The most strips that can be registered at once.
+         */
+        static const uint8_t max_controllers = 16;
+
+        template<template<uint8_t, EOrder> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+        CLEDController &addLeds(CRGB *data, int count, int offset = 0) {
+            CLEDController &controller = controllers[num_controllers < max_controllers ?
+                                                     num_controllers++ : max_controllers - 1];
+            controller.data = data + offset;
+            controller.count = count;
+            controller.data_pin = DATA_PIN;
+            return controller;
+        }
+
+        void setBrightness(uint8_t scale) {
+            brightness = scale;
+        }
+
+        uint8_t getBrightness() const {
+            return brightness;
+        }
+
+        void setMaxPowerInVoltsAndMilliamps(uint8_t volts, uint32_t milliamps) {
+            max_power_mw = volts * milliamps;
+        }
+
+        uint32_t getMaxPowerInMilliwatts() const {
+            return max_power_mw;
+        }
+
+        /**
+         * "Transmit" the frame buffers. On the host this does the same work the real
+         * library does (limiting the power and scaling the colours), skips the time it
+         * would take to send the data to WS2812 LEDs (1.25µs per bit, plus a 50µs
+         * latch per strip) and calls the show hook, if any. Empty strips are skipped.
+         */
+        void show() {
+            const uint8_t scale = max_power_mw == 0xFFFFFFFF ? brightness : limit(brightness);
+
+            uint32_t total = 0;
+            for(uint8_t i = 0; i < num_controllers; ++i) {
+                if(controllers[i].size() == 0) {
+                    continue;
+                }
+                controllers[i].send(scale);
+                const uint32_t taken = 24UL * controllers[i].size() * 5 / 4 + 50;
+                total = parallel ? (taken > total ? taken : total) : total + taken;
+                ++controllers[i].shows;
+            }
+            host::Clock::instance().stall(total);  // Interrupts are off while sending.
+
+            ++shows;
+            if(show_hook != nullptr) {
+                show_hook();
+            }
+        }
+
+        /**
+         * Wait for the given amount of milliseconds. On the host this returns
+         * immediately.
+         */
+        void delay(unsigned long ms) {
+            ::delay(ms);
+        }
+
+        int count() const {
+            return num_controllers;
+        }
+
+        CLEDController &operator[](int x) {
+            return controllers[x];
+        }
+
+        CRGB *leds() {
+            return controllers[0].leds();
+        }
+
+        int size() {
+            return controllers[0].size();
+        }
+
+        /**
+         * Host only. Amount of times show() was called.
+         */
+        uint32_t shows = 0;
+
+        /**
+         * Host only. Whether strips are modelled as being sent at the same time, like
+         * FastLED does on some boards, or one after the other.
+         */
+        bool parallel = false;
+
+        /**
+         * Host only. Function to be called on every show(), e.g. to capture the frame.
+         */
+        void (*show_hook)() = nullptr;
+
+    private:  //////////////////////////////////////////////////////////////////////
+
+        /**
+         * Power drawn by each channel at full, and by an LED that is off, in milliwatts
+         * at 5V, plus the board itself. Same as the real library.
+         */
+        static const uint32_t red_mw = 16 * 5, green_mw = 11 * 5, blue_mw = 15 * 5,
+                              dark_mw = 1 * 5, mcu_mw = 25 * 5;
+
+        /**
+         * Work out the brightness that keeps the LEDs under the power limit, going
+         * through every LED like calculate_max_brightness_for_power_mW() does.
+         */
+        uint8_t limit(uint8_t target) const {
+            uint32_t total_mw = mcu_mw;
+            for(uint8_t i = 0; i < num_controllers; ++i) {
+                uint32_t red = 0, green = 0, blue = 0;
+                for(int n = 0; n < controllers[i].count; ++n) {
+                    red += controllers[i].data[n].r;
+                    green += controllers[i].data[n].g;
+                    blue += controllers[i].data[n].b;
+                }
+                total_mw += ((red * red_mw) >> 8) + ((green * green_mw) >> 8) +
+                            ((blue * blue_mw) >> 8) + dark_mw * controllers[i].count;
+            }
+
+            const uint32_t requested_mw = (total_mw * target) / 256;
+            return requested_mw > max_power_mw ? (target * max_power_mw) / requested_mw : target;
+        }
+
+        CLEDController controllers[max_controllers];
+        uint8_t num_controllers = 0;
+        uint8_t brightness = 0xFF;
+        uint32_t max_power_mw = 0xFFFFFFFF;
+};
+
+/**
+ * The single instance, shared by every translation unit.
+ */
+inline CFastLED &fastled_instance() {
+    static CFastLED instance;
+    return instance;
+}
+
+static CFastLED &FastLED = fastled_instance();
+
+#endif  // HOST_FASTLED_H_
@@ -0,0 +1,25 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Host stand-in for the AVR program memory helpers.                            *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef HOST_AVR_PGMSPACE_H_
+#define HOST_AVR_PGMSPACE_H_
+
+#include <cstdint>  // Fixed width integer types.
+#include <cstring>  // memcpy().
+
+
+// There is a single address space on the host, so flash is just regular memory.
+#define PROGMEM
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr)  (*(const uint8_t *) (addr))
+#define pgm_read_word(addr)  (*(const uint16_t *) (addr))
+#define pgm_read_dword(addr) (*(const uint32_t *) (addr))
+#define memcpy_P(dst, src, n) memcpy((dst), (src), (n))
+
+#endif  // HOST_AVR_PGMSPACE_H_
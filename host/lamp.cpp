@@ -0,0 +1,81 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Host build of the sketch. Runs lamp.ino as is, with whatever comes in on     *
+* stdin as serial commands and whatever it sends over serial on stdout.        *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <cstdio>   // Serial output.
+#include <cstdlib>  // strtoul().
+#include <cstring>  // strcmp().
+
+#include <unistd.h>  // isatty().
+
+#include "../lamp.ino"  // The sketch itself.
+
+
+/**
+ * How many loops a simulated button press lasts.
+ */
+static const unsigned hold = 4;
+
+/**
+ * Print the usage message.
+ *
+ * @param name The name the program was run as.
+ *
+ * @returns The exit code for bad usage.
+ */
+static int usage(const char *name) {
+    fprintf(stderr,
+            "Usage: %s [-n LOOPS] [-b LOOPS]\n"
+            "\n"
+            "Runs the sketch, taking serial commands (e.g. a digit to select an effect)\n"
+            "from stdin unless it is a terminal, and writing what is sent over serial\n"
+            "to stdout.\n"
+            "\n"
+            "  -n LOOPS  Amount of times to run loop() (default 1000).\n"
+            "  -b LOOPS  Press the button every this many loops, more than %u.\n",
+            name, hold);
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    unsigned long loops = 1000, press = 0;
+
+    for(int i = 1; i < argc; ++i) {
+        if((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+            loops = strtoul(argv[++i], nullptr, 0);
+        } else if((strcmp(argv[i], "-b") == 0) && (i + 1 < argc)) {
+            press = strtoul(argv[++i], nullptr, 0);
+            if(press <= hold) {
+                return usage(argv[0]);
+            }
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    Serial.out = stdout;
+    if(!isatty(STDIN_FILENO)) {
+        Serial.in = STDIN_FILENO;
+    }
+
+    setup();
+    for(unsigned long n = 1; n <= loops; ++n) {
+#if LAMP_BUTTON_PIN >= 0
+        // Hold the button down for a few loops, longer than the debounce time at any
+        // frame rate the effects use.
+        if(press > 0) {
+            digitalWrite(LAMP_BUTTON_PIN, (n % press) >= press - hold ? LOW : HIGH);
+        }
+#endif
+        loop();
+    }
+    fflush(stdout);
+
+    fprintf(stderr, "loops: %lu, effect: %u\n", loops, lamp.selected());
+    return 0;
+}
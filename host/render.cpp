@@ -0,0 +1,339 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Headless renderer. Runs an effect on the host for a number of frames, dumps  *
+* them as raw RGB or PPM images and reports how long each frame took.          *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <cstdio>   // File output.
+#include <cstdlib>  // strtoul().
+#include <cstring>  // strcmp().
+#include <vector>   // Frames shown during an update.
+
+#include <fcntl.h>    // Pseudo-terminals.
+#include <termios.h>  // Raw mode.
+
+#ifndef LAMP_ARENA_BUDGET
+// Effects are not limited by the board's memory here, so layered ones that need
+// more than the default arena can be rendered too, on matrices of any size. Some
+// effects keep a few bytes per LED, and there are two of them during transitions.
+#define LAMP_ARENA_BUDGET (2048 + 8 * Effect::num_leds)
+#endif
+
+// The sample clip was made for the default matrix, so it can't be played on others.
+#ifndef EFFECT_GEOMETRY
+#define RENDER_CLIP 1
+#else
+#define RENDER_CLIP 0
+#endif
+
+#include "../effects/effect.h"   // The abstract effect representation.
+#include "../effects/runtime.h"  // Runs and switches effects.
+#include "../effects/fire.h"     // Effect implementations.
+#include "../effects/matrix.h"
+#include "../effects/rainbow.h"
+#include "../effects/stars.h"
+#include "../effects/noise.h"
+#include "../effects/remote.h"
+#include "../effects/clip.h"
+#include "../effects/clips/stars.h"
+#include "../effects/scenes.h"
+
+
+/**
+ * The effects that can be rendered, and the names they go by.
+ */
+#if RENDER_CLIP
+static Runtime<Fire, Matrix, Rainbow, Stars, StarryRainbow, MatrixFire, Lava, Clouds,
+               Remote, Clip<StarsClip>> lamp;
+static const char *const names[] = {
+    "fire", "matrix", "rainbow", "stars", "starry-rainbow", "matrix-fire", "lava", "clouds",
+    "remote", "clip",
+};
+#else
+static Runtime<Fire, Matrix, Rainbow, Stars, StarryRainbow, MatrixFire, Lava, Clouds,
+               Remote> lamp;
+static const char *const names[] = {
+    "fire", "matrix", "rainbow", "stars", "starry-rainbow", "matrix-fire", "lava", "clouds",
+    "remote",
+};
+#endif
+static_assert(sizeof(names) / sizeof(*names) == decltype(lamp)::count, "Every effect needs a name");
+
+/**
+ * The last frame sent to the LEDs.
+ */
+static CRGB frame[Effect::num_leds] = { };
+
+/**
+ * Every frame sent to the LEDs during the current update.
+ */
+static std::vector<CRGB> shown;
+
+/**
+ * Show hook. Copy whatever is being sent to the LEDs.
+ */
+static void capture() {
+    memcpy(frame, FastLED.leds(), sizeof(frame));
+    shown.insert(shown.end(), frame, frame + Effect::num_leds);
+}
+
+/**
+ * Write a frame. The image is `cols` pixels wide and `rows` pixels high, with row
+ * 0 at the bottom like on the lamp.
+ *
+ * @param out The stream to write to.
+ * @param ppm Whether to prepend a PPM header (so consecutive frames form a valid
+ *            multi-image PPM stream) or to write raw RGB triplets.
+ * @param frame The frame to be written.
+ */
+static void dump(FILE *out, bool ppm, const CRGB *frame) {
+    if(ppm) {
+        fprintf(out, "P6\n%u %u\n255\n", Effect::cols, Effect::rows);
+    }
+
+    for(Effect::Coord i = Effect::rows; i > 0; --i) {
+        for(Effect::Coord j = 0; j < Effect::cols; ++j) {
+            const CRGB &pixel = frame[Effect::Shape::index(i - 1, j)];
+            fwrite(pixel.raw, 1, 3, out);
+        }
+    }
+}
+
+/**
+ * Run the selected effect.
+ *
+ * @param frames The amount of updates to run, each showing a frame.
+ * @param cycle Switch to the next effect every this many frames, or 0 to never
+ *              switch.
+ * @param out Where to dump the frames, or null to not dump them.
+ * @param ppm Whether to dump the frames as PPM or raw RGB.
+ */
+static void run(unsigned long frames, unsigned long cycle, FILE *out, bool ppm) {
+    FastLED.show_hook = capture;
+
+    uint64_t total = 0, min = UINT64_MAX, max = 0;
+    for(unsigned long n = 0; n < frames; ++n) {
+        const uint64_t start = host::Clock::instance().busy();
+        if((cycle > 0) && (n > 0) && (n % cycle == 0)) {
+            lamp.next();
+        }
+        lamp.update();
+        const uint64_t cost = host::Clock::instance().busy() - start;
+
+        total += cost;
+        min = cost < min ? cost : min;
+        max = cost > max ? cost : max;
+
+        // Write every frame shown, or the one still on the LEDs if nothing was.
+        if((out != nullptr) && shown.empty()) {
+            dump(out, ppm, frame);
+        } else if(out != nullptr) {
+            for(size_t k = 0; k < shown.size(); k += Effect::num_leds) {
+                dump(out, ppm, &shown[k]);
+            }
+        }
+        shown.clear();
+    }
+
+    if(frames > 0) {
+        fprintf(stderr, "updates: %lu, shows: %u, compute ns/update: min %llu avg %.0f max %llu\n",
+                frames, FastLED.shows, (unsigned long long) min, ((double) total) / frames,
+                (unsigned long long) max);
+        fprintf(stderr, "achieved fps: %.2f, overruns: %u\n", lamp.get() -> achieved_fps(),
+                lamp.get() -> overruns());
+        if(lamp.is<Remote>()) {
+            const Remote *remote = static_cast<const Remote *>(lamp.get());
+            fprintf(stderr, "streamed frames dropped: %u, late: %u\n", remote -> dropped(),
+                    remote -> late());
+        }
+        if(cycle > 0) {
+            fprintf(stderr, "last transition compute us/frame: avg %lu max %lu\n",
+                    (unsigned long) lamp.fader().cost(), (unsigned long) lamp.fader().peak_cost());
+        }
+    }
+}
+
+/**
+ * Describe how the matrix is split across data pins, and how long sending a frame is
+ * modelled to take.
+ */
+static void layout() {
+    typedef Effect::Output Output;
+    for(uint8_t k = 0; k < Output::segments; ++k) {
+        fprintf(stderr, "segment %u: pin %u, columns %u-%u, %u LEDs, %lu us\n", k, Output::pin(k),
+                Output::first(k), Output::first(k) + Output::width(k) - 1, Output::length(k),
+                (unsigned long) Output::time(Output::length(k)));
+    }
+    fprintf(stderr, "frame: %lu us (%s)\n", (unsigned long) Output::frame_time(),
+            EFFECT_PARALLEL_OUTPUT ? "parallel" : "serial");
+}
+
+/**
+ * Describe the SRAM the lamp takes besides the stack, as it would on the board: the
+ * shared frame buffer, the arena and how much of it each effect needs. Sizes are the
+ * host's, which may differ slightly from the board's because of pointer sizes.
+ */
+static void memory() {
+    fprintf(stderr, "frame buffer: %u bytes\n", (unsigned) (sizeof(CRGB) * Effect::num_leds));
+    fprintf(stderr, "arena: %u slot(s) of %u bytes, budget %u\n", lamp.slots, (unsigned) lamp.size,
+            LAMP_ARENA_BUDGET);
+    for(uint8_t n = 0; n < lamp.count; ++n) {
+        fprintf(stderr, "  %-16s %4u bytes\n", names[n], (unsigned) lamp.footprint(n));
+    }
+}
+
+/**
+ * Open a pseudo-terminal to stand in for the serial port, e.g. to stream frames to
+ * the remote effect. Its name is printed, for the other end to open.
+ *
+ * @returns Whether it could be opened.
+ */
+static bool pty() {
+    const int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0)) {
+        perror("pty");
+        return false;
+    }
+
+    // Keep the other end open too, so that bytes sent before anyone connects wait for
+    // them, and it can be reopened. It has to be raw, like a serial port.
+    const int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    struct termios mode;
+    if((slave < 0) || (tcgetattr(slave, &mode) != 0)) {
+        perror("pty");
+        return false;
+    }
+    cfmakeraw(&mode);
+    tcsetattr(slave, TCSANOW, &mode);
+
+    Serial.port = master;
+    fprintf(stderr, "serial: %s\n", ptsname(master));
+    return true;
+}
+
+/**
+ * Print the usage and exit.
+ */
+static int usage(const char *name) {
+    fprintf(stderr,
+            "Usage: %s EFFECT [-n FRAMES] [-c FRAMES] [-f ppm|raw] [-o FILE] [-t FILE] [-s SEED]\n"
+            "       [-p] [-l] [-m]\n"
+            "\n"
+            "  EFFECT     One of fire, matrix, rainbow, stars, starry-rainbow,\n"
+            "             matrix-fire, lava, clouds, remote, clip.\n"
+            "  -n FRAMES  Amount of frames to run (default 100).\n"
+            "  -c FRAMES  Switch to the next effect every this many frames.\n"
+            "  -f FORMAT  Output format, ppm or raw RGB (default ppm).\n"
+            "  -o FILE    Where to write the frames, - for stdout (default: discard).\n"
+            "  -t FILE    Where to write what the lamp sends over serial, e.g. telemetry\n"
+            "             when built with EFFECT_TELEMETRY (default: discard).\n"
+            "  -p         Open a pseudo-terminal as the serial port, e.g. to stream\n"
+            "             frames to the remote effect with host/stream.py.\n"
+            "  -s SEED    Seed for the random number generator.\n"
+            "  -l         Describe the split of the matrix across data pins, and how\n"
+            "             often each one was sent.\n"
+            "  -m         Describe the SRAM taken by the frame buffer and each effect.\n",
+            name);
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    if(argc < 2) {
+        return usage(argv[0]);
+    }
+
+    const char *effect = argv[1];
+    unsigned long frames = 100, cycle = 0;
+    bool ppm = true;
+    const char *output = nullptr, *serial = nullptr;
+    bool pins = false, sram = false, port = false;
+
+    for(int i = 2; i < argc; ++i) {
+        if((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+            frames = strtoul(argv[++i], nullptr, 0);
+        } else if((strcmp(argv[i], "-c") == 0) && (i + 1 < argc)) {
+            cycle = strtoul(argv[++i], nullptr, 0);
+        } else if((strcmp(argv[i], "-f") == 0) && (i + 1 < argc)) {
+            const char *format = argv[++i];
+            if(strcmp(format, "ppm") == 0) {
+                ppm = true;
+            } else if(strcmp(format, "raw") == 0) {
+                ppm = false;
+            } else {
+                return usage(argv[0]);
+            }
+        } else if((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)) {
+            output = argv[++i];
+        } else if((strcmp(argv[i], "-t") == 0) && (i + 1 < argc)) {
+            serial = argv[++i];
+        } else if((strcmp(argv[i], "-s") == 0) && (i + 1 < argc)) {
+            random16_set_seed(strtoul(argv[++i], nullptr, 0));
+        } else if(strcmp(argv[i], "-l") == 0) {
+            pins = true;
+        } else if(strcmp(argv[i], "-m") == 0) {
+            sram = true;
+        } else if(strcmp(argv[i], "-p") == 0) {
+            port = true;
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    uint8_t selected = 0;
+    while((selected < lamp.count) && (strcmp(effect, names[selected]) != 0)) {
+        ++selected;
+    }
+    if(selected == lamp.count) {
+        return usage(argv[0]);
+    }
+
+    FILE *out = nullptr;
+    if(output != nullptr) {
+        out = strcmp(output, "-") == 0 ? stdout : fopen(output, "wb");
+        if(out == nullptr) {
+            perror(output);
+            return 1;
+        }
+    }
+
+    if(serial != nullptr) {
+        Serial.out = strcmp(serial, "-") == 0 ? stdout : fopen(serial, "wb");
+        if(Serial.out == nullptr) {
+            perror(serial);
+            return 1;
+        }
+    }
+
+    if(port && !pty()) {
+        return 1;
+    }
+
+    FastLED.parallel = EFFECT_PARALLEL_OUTPUT;
+    if(pins) {
+        layout();
+    }
+    if(sram) {
+        memory();
+    }
+
+    lamp.select(selected);
+    run(frames, cycle, out, ppm);
+
+    if(pins) {
+        for(uint8_t k = 0; k < Effect::Output::segments; ++k) {
+            fprintf(stderr, "segment %u: sent %u times\n", k, FastLED[k].shows);
+        }
+    }
+
+    if((out != nullptr) && (out != stdout)) {
+        fclose(out);
+    }
+    if((Serial.out != nullptr) && (Serial.out != stdout)) {
+        fclose(Serial.out);
+    }
+
+    return 0;
+}
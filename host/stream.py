@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+################################################################################
+# Streams pre-rendered frames to the lamp's remote effect over serial.         #
+#                                                                              #
+# Frames are read as raw RGB, as written by `render -f raw`, and each one is   #
+# sent in whichever of the encodings described in effects/remote.h is the     #
+# smallest. The lamp acknowledges every packet, and the next one is only sent  #
+# after that, so frames go as fast as the link and the lamp allow.             #
+#                                                                              #
+# Author:   Kip (https://github.com/kip93/).                                   #
+# Source:   https://github.com/kip93/lamp/                                     #
+# License:  BSD 3-Clause                                                       #
+################################################################################
+
+import argparse
+import os
+import select
+import sys
+import termios
+import time
+import tty
+
+SYNC = b'\x5a\xa5'
+ACK = 0x06
+
+# Packet types, as in Remote::Type.
+FULL, DELTA, RLE, PALETTE, COMMAND = 1, 2, 3, 4, 5
+NAMES = {FULL: 'full', DELTA: 'delta', RLE: 'rle', PALETTE: 'palette'}
+
+MAX_COLOURS = 16
+
+
+def storage_order(image, rows, cols):
+    """Turn an image (top row first, as render writes them) into a list of colours
+    in the order the lamp stores them: column by column, from the bottom up."""
+    pixels = [image[k:k + 3] for k in range(0, len(image), 3)]
+    return [pixels[(rows - 1 - i) * cols + j] for j in range(cols) for i in range(rows)]
+
+
+def runs(leds):
+    """Split a list of colours into runs of the same colour, at most 255 long."""
+    out = []
+    for colour in leds:
+        if out and out[-1][1] == colour and out[-1][0] < 255:
+            out[-1][0] += 1
+        else:
+            out.append([1, colour])
+    return out
+
+
+def encode_full(leds):
+    return b''.join(leds)
+
+
+def encode_rle(leds):
+    return b''.join(bytes([count]) + colour for count, colour in runs(leds))
+
+
+def encode_palette(leds, last_palette):
+    """Returns the payload and the palette, or None if there are too many colours."""
+    palette = sorted(set(leds))
+    if len(palette) > MAX_COLOURS:
+        return None, None
+    if palette == last_palette:
+        header = b'\x00'
+    else:
+        header = bytes([len(palette)]) + b''.join(palette)
+    index = {colour: k for k, colour in enumerate(palette)}
+    return header + b''.join(bytes([count, index[colour]]) for count, colour in runs(leds)), palette
+
+
+def encode_delta(leds, previous):
+    out = bytearray()
+    skip = 0
+    k = 0
+    while k < len(leds):
+        if leds[k] == previous[k]:
+            skip += 1
+            k += 1
+            continue
+        while skip > 255:
+            out += bytes([255, 0])
+            skip -= 255
+        changed = []
+        while k < len(leds) and leds[k] != previous[k] and len(changed) < 255:
+            changed.append(leds[k])
+            k += 1
+        out += bytes([skip, len(changed)]) + b''.join(changed)
+        skip = 0
+    return bytes(out)
+
+
+def packet(kind, sequence, payload):
+    body = bytes([kind, sequence, len(payload) & 0xFF, len(payload) >> 8]) + payload
+    checksum = 0
+    for byte in body:
+        checksum ^= byte
+    return SYNC + body + bytes([checksum])
+
+
+class Port:
+    """A serial port, or anything that behaves like one (e.g. a pseudo-terminal)."""
+
+    def __init__(self, path, baud):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd, termios.TCSANOW)  # Flushing would lose what the lamp sent.
+        mode = termios.tcgetattr(self.fd)
+        speed = getattr(termios, 'B%d' % baud, None)
+        if speed is not None:
+            mode[4] = mode[5] = speed
+            termios.tcsetattr(self.fd, termios.TCSANOW, mode)
+        self.pending = b''
+
+    def send(self, data):
+        while data:
+            data = data[os.write(self.fd, data):]
+
+    def ack(self, timeout):
+        """Wait for an acknowledgement. Returns (sequence, stale, dropped, late), or
+        None on timeout. Anything else sent by the lamp is skipped."""
+        deadline = time.monotonic() + timeout
+        while True:
+            start = self.pending.find(bytes([ACK]))
+            while start >= 0 and len(self.pending) >= start + 6:
+                ack = self.pending[start + 1:start + 6]
+                if ack[0] ^ ack[1] ^ ack[2] ^ ack[3] == ack[4]:
+                    self.pending = self.pending[start + 6:]
+                    return ack[0], bool(ack[1] & 1), ack[2], ack[3]
+                start = self.pending.find(bytes([ACK]), start + 1)
+
+            left = deadline - time.monotonic()
+            if left <= 0 or not select.select([self.fd], [], [], left)[0]:
+                return None
+            self.pending += os.read(self.fd, 256)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Stream frames to the lamp.')
+    parser.add_argument('port', help='serial port (or pseudo-terminal) of the lamp')
+    parser.add_argument('frames', help='raw RGB frames, as written by render -f raw (- for stdin)')
+    parser.add_argument('-b', '--baud', type=int, default=115200, help='baud rate')
+    parser.add_argument('-r', '--rows', type=int, default=16, help='rows of the matrix')
+    parser.add_argument('-c', '--cols', type=int, default=14, help='columns of the matrix')
+    parser.add_argument('-s', '--select', help='effect number to send first, to pick the '
+                        'remote effect')
+    parser.add_argument('-e', '--escape', help='command to send once the frames are over, '
+                        'e.g. n to leave the remote effect')
+    parser.add_argument('-t', '--timeout', type=float, default=1.0,
+                        help='seconds to wait for each acknowledgement')
+    args = parser.parse_args()
+
+    size = args.rows * args.cols * 3
+    source = sys.stdin.buffer if args.frames == '-' else open(args.frames, 'rb')
+    port = Port(args.port, args.baud)
+
+    if args.select is not None:
+        port.send(args.select.encode())
+    ready = port.ack(args.timeout + 2)
+    if ready is None:
+        print('no answer from the lamp, sending anyway', file=sys.stderr)
+
+    sequence = 0
+    previous = None  # What the lamp is known to show.
+    palette = None   # The palette the lamp is known to hold.
+    stale = True
+    sent = {kind: [0, 0] for kind in NAMES}
+    status = (0, 0)
+    lost = 0
+    started = time.monotonic()
+
+    while True:
+        image = source.read(size)
+        if len(image) < size:
+            break
+        leds = storage_order(image, args.rows, args.cols)
+
+        options = [(FULL, encode_full(leds), None), (RLE, encode_rle(leds), None)]
+        payload, colours = encode_palette(leds, palette)
+        if payload is not None:
+            options.append((PALETTE, payload, colours))
+        if not stale and previous is not None:
+            options.append((DELTA, encode_delta(leds, previous), None))
+        kind, payload, colours = min(options, key=lambda option: len(option[1]))
+
+        port.send(packet(kind, sequence, payload))
+        sent[kind][0] += 1
+        sent[kind][1] += len(payload) + 7
+
+        ack = port.ack(args.timeout)
+        if ack is None or ack[0] != sequence:
+            lost += 1
+            stale = True
+            palette = None
+        else:
+            stale = ack[1]
+            status = ack[2:]
+            if not stale:
+                previous = leds
+                palette = colours if kind == PALETTE else palette
+            else:
+                palette = None  # The lamp may have dropped it, so send it again.
+        sequence = (sequence + 1) & 0xFF
+
+    if args.escape is not None:
+        # Plain commands would be taken for frames, so it goes in a packet.
+        port.send(packet(COMMAND, sequence, args.escape.encode()[:1]))
+        ack = port.ack(args.timeout)
+        if ack is None or ack[0] != sequence:
+            print('the lamp didn\'t acknowledge the command', file=sys.stderr)
+
+    elapsed = time.monotonic() - started
+    frames = sum(count for count, _ in sent.values())
+    for kind, (count, total) in sent.items():
+        if count:
+            print('%-8s %6d frames %8d bytes' % (NAMES[kind], count, total), file=sys.stderr)
+    print('%d frames in %.2fs (%.2f fps), %d unanswered; lamp reports %d dropped, %d late'
+          % (frames, elapsed, frames / elapsed if elapsed else 0, lost, status[0], status[1]),
+          file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+################################################################################
+# Decoder for the frame timing telemetry sent by the lamp over serial.         #
+#                                                                              #
+# Reads the binary records described in effects/telemetry.h from a file, a    #
+# serial port or stdin, and prints one line per record. Bytes that are not     #
+# part of a valid record (e.g. anything else written to the port) are skipped. #
+#                                                                              #
+# Author:   Kip (https://github.com/kip93/).                                   #
+# Source:   https://github.com/kip93/lamp/                                     #
+# License:  BSD 3-Clause                                                       #
+################################################################################
+
+import argparse
+import struct
+import sys
+
+SYNC = b'\xa5\x5a'
+VERSION = 3
+
+# Phase names, in the order they are sent (as in Effect::Phase).
+PHASES = ['effect', 'fill', 'show', 'wait']
+
+# Upper bounds of the histogram buckets of busy time per frame, in ms. The last one
+# has none.
+BUCKETS = [1, 2, 4, 8, 16, 32, 64]
+
+# Payload: frames, overruns, dropped records, time covered, min/avg/max per phase, the
+# peak power asked for, the frames dimmed by the power limiter, then the histogram.
+PAYLOAD = struct.Struct('<HHHI' + 'HHH' * len(PHASES) + 'HH' + 'H' * (len(BUCKETS) + 1))
+
+
+def records(stream):
+    """Yield every valid record in a stream as a dict."""
+    data = b''
+    while True:
+        chunk = stream.read(1)  # Records are small and few, and ports must not block.
+        if not chunk:
+            return
+        data += chunk
+
+        while True:
+            start = data.find(SYNC)
+            if start < 0:
+                data = data[-1:]  # May hold the first half of the next sync.
+                break
+            data = data[start:]
+            if len(data) < 4:
+                break
+
+            version, length = data[2], data[3]
+            if version != VERSION or length != PAYLOAD.size:
+                data = data[1:]
+                continue
+            if len(data) < 4 + length + 1:
+                break
+
+            payload = data[4:4 + length]
+            checksum = 0
+            for byte in payload:
+                checksum ^= byte
+            if checksum != data[4 + length]:
+                data = data[1:]
+                continue
+            data = data[4 + length + 1:]
+
+            fields = PAYLOAD.unpack(payload)
+            record = {'frames': fields[0], 'overruns': fields[1], 'dropped': fields[2],
+                      'time': fields[3]}
+            for k, phase in enumerate(PHASES):
+                record[phase] = fields[4 + 3 * k:7 + 3 * k]
+            phases = 4 + 3 * len(PHASES)
+            record['power'], record['dimmed'] = fields[phases:phases + 2]
+            record['busy'] = fields[phases + 2:]
+            yield record
+
+
+def open_input(path, baud):
+    """Open the input, which may be a serial port."""
+    if path == '-':
+        return sys.stdin.buffer
+    if path.startswith('/dev/'):
+        try:
+            import serial
+        except ImportError:
+            sys.exit('Reading from a serial port needs pyserial (pip install pyserial)')
+        return serial.Serial(path, baud)
+    return open(path, 'rb')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the lamp\'s frame timing telemetry.')
+    parser.add_argument('input', nargs='?', default='-',
+                        help='file or serial port to read from (default: stdin)')
+    parser.add_argument('-b', '--baud', type=int, default=115200,
+                        help='baud rate, when reading from a serial port')
+    args = parser.parse_args()
+
+    print('%6s %8s %7s %5s %6s %6s  ' % ('frames', 'fps', 'overrun', 'drop', 'mW', 'dimmed') +
+          '  '.join('%-17s' % (phase + ' min/avg/max') for phase in PHASES) +
+          '  busy <' + '/<'.join('%d' % ms for ms in BUCKETS) + '/more ms')
+    for record in records(open_input(args.input, args.baud)):
+        fps = record['frames'] * 1e6 / record['time'] if record['time'] else 0
+        print('%6d %8.2f %7d %5d %6d %6d  ' % (record['frames'], fps, record['overruns'],
+                                               record['dropped'], record['power'],
+                                               record['dimmed']) +
+              '  '.join('%5d/%5d/%5d' % record[phase] for phase in PHASES) +
+              '  ' + '/'.join('%d' % count for count in record['busy']), flush=True)
+
+
+if __name__ == '__main__':
+    main()
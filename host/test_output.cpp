@@ -0,0 +1,119 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * \
+* Host checks of how the matrix is split across data pins (effects/output.h). *
+* Aborts on the first check that fails.                                        *
+*                                                                              *
+* Author:   Kip (https://github.com/kip93/).                                   *
+* Source:   https://github.com/kip93/lamp/                                     *
+* License:  BSD 3-Clause                                                       *
+\ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#undef NDEBUG
+#include <cassert>  // assert().
+#include <cstdio>   // printf().
+
+#include "../effects/output.h"  // What is being checked.
+
+
+/**
+ * Check that the segments of a layout cover every column once, in order, and that
+ * each one is a contiguous slice of the frame buffer as wired.
+ */
+template<class L> static void check_segments() {
+    typedef typename L::Wired G;
+
+    typename G::Coord next = 0;
+    for(uint8_t k = 0; k < L::segments; ++k) {
+        assert(L::first(k) == next);
+        assert(L::width(k) > 0);
+        assert(L::width(k) <= L::span);
+        assert(L::length(k) == (typename G::Index) L::width(k) * G::rows);
+        next += L::width(k);
+
+        // Every LED of the segment lies in its slice, which starts at its first column.
+        const typename G::Index begin = G::index(0, L::first(k)), end = begin + L::length(k);
+        assert(begin == (typename G::Index) L::first(k) * G::rows);
+        for(typename G::Coord j = L::first(k); j < L::first(k) + L::width(k); ++j) {
+            assert(L::segment(j) == k);
+            for(typename G::Coord i = 0; i < G::rows; ++i) {
+                assert((G::index(i, j) >= begin) && (G::index(i, j) < end));
+            }
+        }
+    }
+    assert(next == G::cols);
+
+    // Walking the strip line by line goes through the frame buffer in order.
+    typename G::Index n = 0;
+    for(typename G::Coord line = 0; line < G::lines; ++line) {
+        for(typename G::Coord k = 0; k < G::length; ++k) {
+            assert(G::index(G::line_row(line, k), G::line_col(line, k)) == n++);
+        }
+    }
+    assert(n == G::num_leds);
+}
+
+/**
+ * Check that the time taken to send LEDs matches WS2812 timings, and that a frame
+ * takes the time of its segments.
+ */
+template<class L> static void check_time() {
+    assert(L::time(0) == 50);
+    assert(L::time(1) == 30 + 50);
+    assert(L::time(224) == 6720 + 50);
+
+    uint32_t total = 0, longest = 0;
+    for(uint8_t k = 0; k < L::segments; ++k) {
+        const uint32_t taken = L::time(L::length(k));
+        total += taken;
+        longest = taken > longest ? taken : longest;
+    }
+    assert(L::frame_time() == (EFFECT_PARALLEL_OUTPUT ? longest : total));
+}
+
+int main() {
+    // The lamp: a single pin.
+    typedef Layout<LampGeometry, 13> Lamp;
+    static_assert(Lamp::segments == 1, "The lamp has a single pin");
+    assert(Lamp::width(0) == 14);
+    assert(Lamp::frame_time() == 30UL * 224 + 50);
+    check_segments<Lamp>();
+    check_time<Lamp>();
+
+    // An uneven split: 14 columns over 3 pins take 5, 5 and 4.
+    typedef Layout<LampGeometry, 13, 12, 11> Three;
+    assert(Three::span == 5);
+    assert((Three::width(0) == 5) && (Three::width(1) == 5) && (Three::width(2) == 4));
+    assert((Three::segment(4) == 0) && (Three::segment(5) == 1) && (Three::segment(13) == 2));
+    assert(Three::frame_time() == 3 * 50 + 30UL * 224);
+    check_segments<Three>();
+    check_time<Three>();
+
+    // As many pins as columns.
+    typedef Layout<Geometry<4, 3>, 5, 6, 7> Single;
+    assert((Single::span == 1) && (Single::width(2) == 1));
+    check_segments<Single>();
+    check_time<Single>();
+
+    // A serpentine strip starts over on every pin. Columns 3 and 4 are the first and
+    // second of the second strip, so 3 runs up and 4 runs down.
+    typedef Layout<Geometry<4, 5, COLUMN_MAJOR, true>, 1, 2> Zigzag;
+    typedef Zigzag::Wired Z;
+    assert(Zigzag::span == 3);
+    assert((Z::index(0, 1) == 7) && (Z::index(3, 1) == 4));
+    assert((Z::index(0, 2) == 8) && (Z::index(3, 2) == 11));
+    assert((Z::index(0, 3) == 12) && (Z::index(3, 3) == 15));
+    assert((Z::index(0, 4) == 19) && (Z::index(3, 4) == 16));
+    check_segments<Zigzag>();
+
+    // With a single pin the wiring is the geometry's own.
+    typedef Geometry<3, 4, ROW_MAJOR, true> Rows;
+    typedef Layout<Rows, 1>::Wired R;
+    for(uint8_t i = 0; i < 3; ++i) {
+        for(uint8_t j = 0; j < 4; ++j) {
+            assert(R::index(i, j) == Rows::index(i, j));
+        }
+    }
+    check_segments<Layout<Rows, 1>>();
+
+    printf("output: all checks passed\n");
+    return 0;
+}
@@ -6,13 +6,122 @@
 * License:  BSD 3-Clause                                                       *
 \ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-#include "effects/effect.h"  // The abstract effect representation.
-#include "effects/fire.h"    // The desired effect implementation.
+#ifdef LAMP_BENCH
+#include "bench/probe.h"     // Benchmark instrumentation. Must come before effects.
+#endif
 
+#include "effects/effect.h"   // The abstract effect representation.
+#include "effects/memory.h"   // SRAM usage monitoring.
+#include "effects/runtime.h"  // Runs and switches effects.
+#include "effects/fire.h"     // The available effect implementations.
+#include "effects/matrix.h"
+#include "effects/rainbow.h"
+#include "effects/stars.h"
+#include "effects/noise.h"
+#include "effects/remote.h"   // Frames streamed over serial.
+#include "effects/scenes.h"   // Effects made out of the ones above.
+
+#ifndef LAMP_EFFECT
+/**
+ * The effect to be shown at start up. Change it here or define it when compiling.
+ */
+#define LAMP_EFFECT Fire
+#endif
+
+#ifndef LAMP_BUTTON_PIN
+/**
+ * Pin of the button that switches to the next effect, wired to ground. It has to be
+ * able to trigger an interrupt (2 or 3 on an Uno or a Nano), so presses are caught
+ * while an effect is busy. Set it to -1 to go without a button.
+ */
+#define LAMP_BUTTON_PIN 2
+#endif
+
+#ifndef LAMP_SERIAL_BAUD
+/**
+ * Baud rate for serial commands. Sending a digit selects that effect, and sending
+ * `n` switches to the next one. While streaming to the remote effect commands have to
+ * be sent in a command packet instead (see effects/remote.h). Set it to 0 to go
+ * without serial commands.
+ */
+#define LAMP_SERIAL_BAUD 115200
+#endif
+
+#if (EFFECT_TELEMETRY > 0) && (LAMP_SERIAL_BAUD == 0)
+#error "Telemetry is sent over serial, so LAMP_SERIAL_BAUD can't be 0"
+#endif
+
+#ifndef LAMP_MEMORY_CHECK
+/**
+ * How often to check how close the stack got to the heap, in milliseconds. A warning
+ * is sent over serial whenever it gets closer than LAMP_MEMORY_MARGIN bytes, and the
+ * memory left is sent at start up. Set it to 0 to not check.
+ */
+#define LAMP_MEMORY_CHECK 1000
+#endif
+
+#ifndef LAMP_MEMORY_MARGIN
+/**
+ * How many bytes between the stack and the heap are considered too few.
+ */
+#define LAMP_MEMORY_MARGIN 128
+#endif
+
+/**
+ * How long the button has to be steady before going low counts as a press, in
+ * milliseconds.
+ */
+#define LAMP_DEBOUNCE 30
+
+/**
+ * The effects that can be shown, and the one being shown.
+ */
+Runtime<Fire, Matrix, Rainbow, Stars, StarryRainbow, Remote, Lava> lamp;
+
+/**
+ * Send over serial how much SRAM the lamp takes: the frame buffer shared by all
+ * effects, the arena holding the running ones, the heap and what is left. How much of
+ * the arena each effect needs is known at build time, so it is left to the
+ * benchmarks (see bench/bench.py) rather than sent on every boot.
+ */
+void report_memory() {
+#if LAMP_SERIAL_BAUD > 0
+    Serial.print(F("sram: frame buffer "));
+    Serial.print(sizeof(CRGB) * Effect::num_leds);
+    Serial.print(F(", arena "));
+    Serial.print(lamp.slots * lamp.size);
+    Serial.print(F(" of "));
+    Serial.print(LAMP_ARENA_BUDGET);
+    Serial.print(F(", heap "));
+    Serial.print(Memory::heap());
+    Serial.print(F(", free "));
+    Serial.println(Memory::available());
+#endif
+}
+
+#if LAMP_BUTTON_PIN >= 0
 /**
- * Global variable to keep the effect to be shown.
+ * Whether the button was pressed since pressed() last looked.
  */
-Effect *effect;
+volatile bool latched = false;
+
+/**
+ * Interrupt handler for any change of the button pin. Effects can take hundreds of
+ * milliseconds for a frame, so a press is latched here as it happens rather than
+ * looked for between frames. A change only counts as a press if the pin went low
+ * after being steady for a while, which leaves out the bouncing of both pressing
+ * and letting go.
+ */
+void on_button() {
+    static unsigned long last = 0;
+
+    const unsigned long now = millis();
+    if((digitalRead(LAMP_BUTTON_PIN) == LOW) && (now - last >= LAMP_DEBOUNCE)) {
+        latched = true;
+    }
+    last = now;
+}
+#endif
 
 /**
  * Code to be run at start up.
@@ -21,15 +130,108 @@ Effect *effect;
  * booting, and then sets up the desired effect.
  */
 void setup() {
+    Memory::paint();
     delay(1000);
-    effect = new Fire();
+#if LAMP_BUTTON_PIN >= 0
+    pinMode(LAMP_BUTTON_PIN, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(LAMP_BUTTON_PIN), on_button, CHANGE);
+#endif
+#if LAMP_SERIAL_BAUD > 0
+    Serial.begin(LAMP_SERIAL_BAUD);
+#endif
+    lamp.start<LAMP_EFFECT>();
+#ifdef LAMP_BENCH
+    bench_begin();
+#endif
+#if (LAMP_MEMORY_CHECK > 0) && (LAMP_SERIAL_BAUD > 0)
+    report_memory();
+#endif
+}
+
+/**
+ * Check how close the stack ever got to the heap, and warn over serial whenever it
+ * gets closer than ever before once under LAMP_MEMORY_MARGIN bytes.
+ */
+void check_memory() {
+#if (LAMP_MEMORY_CHECK > 0) && (LAMP_SERIAL_BAUD > 0)
+    static unsigned long last = 0;
+    static uint16_t closest = LAMP_MEMORY_MARGIN;
+
+    if(!Memory::supported || (millis() - last < LAMP_MEMORY_CHECK)) {
+        return;
+    }
+    last = millis();
+
+    const uint16_t margin = Memory::margin();
+    if(margin < closest) {
+        closest = margin;
+        Serial.print(F("sram: low memory, "));
+        Serial.print(margin);
+        Serial.print(F(" bytes left between stack (peak "));
+        Serial.print(Memory::stack_peak());
+        Serial.print(F(") and heap ("));
+        Serial.print(Memory::heap());
+        Serial.println(F(")"));
+    }
+#endif
+}
+
+/**
+ * Check whether the button was pressed.
+ *
+ * @returns True once per press, however long ago it happened.
+ */
+bool pressed() {
+#if LAMP_BUTTON_PIN >= 0
+    noInterrupts();
+    const bool was = latched;
+    latched = false;
+    interrupts();
+    return was;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Get the next serial command. While streaming, whatever comes in is a packet for the
+ * remote effect, which passes on the commands sent in command packets.
+ *
+ * @returns The command, or -1 if there's none.
+ */
+int command() {
+#if LAMP_SERIAL_BAUD > 0
+    if(lamp.is<Remote>()) {
+        return static_cast<Remote *>(lamp.get())->command();
+    }
+    return Serial.available() > 0 ? Serial.read() : -1;
+#else
+    return -1;
+#endif
 }
 
 /**
  * Code to be repeatedly run forever.
  *
- * This just calls the update method on the effect.
+ * This updates the current effect, and then handles any requests to switch to
+ * another one, so that switching always happens between two frames.
  */
 void loop() {
-    effect -> update();
+    lamp.update();
+#ifdef LAMP_BENCH
+    bench_frame(lamp);
+#endif
+    check_memory();
+
+    if(pressed()) {
+        lamp.next();
+    }
+
+    for(int next = command(); next >= 0; next = command()) {
+        if((next >= '0') && (next < '0' + lamp.count)) {
+            lamp.select(next - '0');
+        } else if(next == 'n') {
+            lamp.next();
+        }
+    }
 }